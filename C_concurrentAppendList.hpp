@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+
+namespace gg
+{
+
+//Append only list where any number of threads can push_back and iterate at the same time without locking.
+//Producers reserve a place in the tail block with a fetch-add on its cursor, construct the element
+//and publish it by setting its occupancy bit, a full tail block is followed by a new one linked with a CAS.
+//Readers only see published elements, an element reserved but not yet published is skipped.
+//Destruction and move must not happen while other threads are using the list, a moved from list can only be destroyed or assigned.
+template<class T, class TBlockSize=uint16_t>
+class ConcurrentAppendList
+{
+    static_assert(std::is_fundamental_v<TBlockSize> && std::is_unsigned_v<TBlockSize>, "TBlockSize must be fundamental and unsigned type !");
+    static_assert(std::atomic<TBlockSize>::is_always_lock_free, "TBlockSize must be lock free as an atomic !");
+
+    struct Block
+    {
+        std::atomic<std::size_t> _cursor{0};
+        std::atomic<TBlockSize> _occupiedFlags{0};
+        std::atomic<Block*> _nextBlock{nullptr};
+        alignas(T) uint8_t _data[sizeof(T)*sizeof(TBlockSize)*8];
+    };
+    using BlockIndex = unsigned short;
+
+    constexpr static BlockIndex gIndexLast = sizeof(TBlockSize) * 8 - 1;
+
+public:
+    using value_type = T;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = value_type const*;
+        using reference         = value_type const&;
+
+        const_iterator() = default;
+
+        const_iterator& operator++();
+        const_iterator operator++(int) {auto copy=*this; this->operator++(); return copy;}
+
+        [[nodiscard]] reference operator*() const;
+        [[nodiscard]] pointer operator->() const;
+
+        [[nodiscard]] bool operator==(const_iterator const& r) const;
+        [[nodiscard]] bool operator!=(const_iterator const& r) const;
+
+    private:
+        explicit const_iterator(Block* block);
+        void skipEmptyBlocks();
+
+        Block* _block{nullptr};
+        TBlockSize _remainingFlags{0}; //Published places of the block not yet visited
+        BlockIndex _index{0};
+        friend ConcurrentAppendList;
+    };
+
+    ConcurrentAppendList();
+    ConcurrentAppendList(ConcurrentAppendList const& r) = delete;
+    ConcurrentAppendList(ConcurrentAppendList&& r) noexcept;
+    ~ConcurrentAppendList();
+
+    ConcurrentAppendList& operator=(ConcurrentAppendList const& r) = delete;
+    ConcurrentAppendList& operator=(ConcurrentAppendList&& r) noexcept;
+
+    template<class U>
+    void push_back(U&& value);
+    template<class... TArgs>
+    T& emplace_back(TArgs&&... value);
+
+    //Count the published elements by walking the blocks, this is O(blocks)
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t block_count() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator cbegin() const;
+    [[nodiscard]] const_iterator end() const;
+    [[nodiscard]] const_iterator cend() const;
+
+private:
+    [[nodiscard]] Block* reservePlace(BlockIndex& index);
+    void freeBlocks();
+
+    [[nodiscard]] static BlockIndex lowestIndex(TBlockSize flags);
+    [[nodiscard]] static BlockIndex popCount(TBlockSize flags);
+
+    Block* g_startBlock;
+    alignas(64) std::atomic<Block*> g_tailBlock; //Kept on its own cache line as every producer hits it
+};
+
+#include "C_concurrentAppendList.inl"
+
+}//end gg
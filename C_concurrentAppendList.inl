@@ -0,0 +1,269 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//const_iterator
+template<class T, class TBlockSize>
+ConcurrentAppendList<T, TBlockSize>::const_iterator::const_iterator(Block* block) :
+        _block(block)
+{
+    if (this->_block != nullptr)
+    {
+        this->_remainingFlags = this->_block->_occupiedFlags.load(std::memory_order_acquire);
+        this->skipEmptyBlocks();
+    }
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator& ConcurrentAppendList<T, TBlockSize>::const_iterator::operator++()
+{
+    this->_remainingFlags &= static_cast<TBlockSize>(this->_remainingFlags-1);
+    this->skipEmptyBlocks();
+    return *this;
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator::reference ConcurrentAppendList<T, TBlockSize>::const_iterator::operator*() const
+{
+    return reinterpret_cast<T const*>(this->_block->_data)[this->_index];
+}
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator::pointer ConcurrentAppendList<T, TBlockSize>::const_iterator::operator->() const
+{
+    return reinterpret_cast<T const*>(this->_block->_data) + this->_index;
+}
+
+template<class T, class TBlockSize>
+bool ConcurrentAppendList<T, TBlockSize>::const_iterator::operator==(const_iterator const& r) const
+{
+    return this->_block == r._block && this->_remainingFlags == r._remainingFlags;
+}
+template<class T, class TBlockSize>
+bool ConcurrentAppendList<T, TBlockSize>::const_iterator::operator!=(const_iterator const& r) const
+{
+    return this->_block != r._block || this->_remainingFlags != r._remainingFlags;
+}
+
+template<class T, class TBlockSize>
+void ConcurrentAppendList<T, TBlockSize>::const_iterator::skipEmptyBlocks()
+{
+    //The flags of a block are read once when entering it, the acquire pairs with the release of the producer
+    while (this->_remainingFlags == 0)
+    {
+        this->_block = this->_block->_nextBlock.load(std::memory_order_acquire);
+        if (this->_block == nullptr)
+        {
+            return;
+        }
+        this->_remainingFlags = this->_block->_occupiedFlags.load(std::memory_order_acquire);
+    }
+    this->_index = lowestIndex(this->_remainingFlags);
+}
+
+//ConcurrentAppendList
+template<class T, class TBlockSize>
+ConcurrentAppendList<T, TBlockSize>::ConcurrentAppendList() :
+        g_startBlock{new Block},
+        g_tailBlock{g_startBlock}
+{}
+template<class T, class TBlockSize>
+ConcurrentAppendList<T, TBlockSize>::ConcurrentAppendList(ConcurrentAppendList&& r) noexcept :
+        g_startBlock{r.g_startBlock},
+        g_tailBlock{r.g_tailBlock.load(std::memory_order_relaxed)}
+{
+    r.g_startBlock = nullptr;
+    r.g_tailBlock.store(nullptr, std::memory_order_relaxed);
+}
+template<class T, class TBlockSize>
+ConcurrentAppendList<T, TBlockSize>::~ConcurrentAppendList()
+{
+    this->freeBlocks();
+}
+
+template<class T, class TBlockSize>
+ConcurrentAppendList<T, TBlockSize>& ConcurrentAppendList<T, TBlockSize>::operator=(ConcurrentAppendList&& r) noexcept
+{
+    if (this != &r)
+    {
+        this->freeBlocks();
+        this->g_startBlock = r.g_startBlock;
+        this->g_tailBlock.store(r.g_tailBlock.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        r.g_startBlock = nullptr;
+        r.g_tailBlock.store(nullptr, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+template<class T, class TBlockSize>
+template<class U>
+void ConcurrentAppendList<T, TBlockSize>::push_back(U&& value)
+{
+    this->emplace_back(std::forward<U>(value));
+}
+template<class T, class TBlockSize>
+template<class... TArgs>
+T& ConcurrentAppendList<T, TBlockSize>::emplace_back(TArgs&&... value)
+{
+    BlockIndex index;
+    Block* block = this->reservePlace(index);
+
+    //If the constructor throws, the place stay reserved but is never published
+    T* data = reinterpret_cast<T*>(block->_data) + index;
+    new (data) T(std::forward<TArgs>(value)...);
+
+    block->_occupiedFlags.fetch_or(static_cast<TBlockSize>(static_cast<TBlockSize>(1) << index), std::memory_order_release);
+    return *data;
+}
+
+template<class T, class TBlockSize>
+std::size_t ConcurrentAppendList<T, TBlockSize>::size() const noexcept
+{
+    std::size_t count = 0;
+    for (Block const* block=this->g_startBlock; block!=nullptr; block=block->_nextBlock.load(std::memory_order_acquire))
+    {
+        count += popCount(block->_occupiedFlags.load(std::memory_order_relaxed));
+    }
+    return count;
+}
+template<class T, class TBlockSize>
+std::size_t ConcurrentAppendList<T, TBlockSize>::block_count() const noexcept
+{
+    std::size_t count = 0;
+    for (Block const* block=this->g_startBlock; block!=nullptr; block=block->_nextBlock.load(std::memory_order_acquire))
+    {
+        ++count;
+    }
+    return count;
+}
+template<class T, class TBlockSize>
+bool ConcurrentAppendList<T, TBlockSize>::empty() const noexcept
+{
+    return this->begin() == this->end();
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator ConcurrentAppendList<T, TBlockSize>::begin() const
+{
+    return const_iterator{this->g_startBlock};
+}
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator ConcurrentAppendList<T, TBlockSize>::cbegin() const
+{
+    return const_iterator{this->g_startBlock};
+}
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator ConcurrentAppendList<T, TBlockSize>::end() const
+{
+    return const_iterator{};
+}
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::const_iterator ConcurrentAppendList<T, TBlockSize>::cend() const
+{
+    return const_iterator{};
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::Block* ConcurrentAppendList<T, TBlockSize>::reservePlace(BlockIndex& index)
+{
+    Block* block = this->g_tailBlock.load(std::memory_order_acquire);
+    while (true)
+    {
+        auto const place = block->_cursor.fetch_add(1, std::memory_order_relaxed);
+        if (place <= gIndexLast)
+        {
+            index = static_cast<BlockIndex>(place);
+            return block;
+        }
+
+        //The block is full, link a new one after it if no other producer did it already
+        Block* nextBlock = block->_nextBlock.load(std::memory_order_acquire);
+        if (nextBlock == nullptr)
+        {
+            Block* newBlock = new Block;
+            if (block->_nextBlock.compare_exchange_strong(nextBlock, newBlock, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                nextBlock = newBlock;
+            }
+            else
+            {
+                delete newBlock;
+            }
+        }
+
+        //On failure an other producer already moved the tail, block is then reloaded with it
+        if (this->g_tailBlock.compare_exchange_strong(block, nextBlock, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            block = nextBlock;
+        }
+    }
+}
+
+template<class T, class TBlockSize>
+void ConcurrentAppendList<T, TBlockSize>::freeBlocks()
+{
+    Block* block = this->g_startBlock;
+    while (block != nullptr)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            auto flags = block->_occupiedFlags.load(std::memory_order_relaxed);
+            for (; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+            {
+                reinterpret_cast<T*>(block->_data)[lowestIndex(flags)].~T();
+            }
+        }
+        Block* nextBlock = block->_nextBlock.load(std::memory_order_relaxed);
+        delete block;
+        block = nextBlock;
+    }
+    this->g_startBlock = nullptr;
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::BlockIndex ConcurrentAppendList<T, TBlockSize>::lowestIndex(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(__builtin_ctzll(flags));
+#else
+    BlockIndex index = 0;
+    while ((flags & 1) == 0)
+    {
+        flags >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+template<class T, class TBlockSize>
+typename ConcurrentAppendList<T, TBlockSize>::BlockIndex ConcurrentAppendList<T, TBlockSize>::popCount(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(__builtin_popcountll(flags));
+#else
+    BlockIndex count = 0;
+    for (; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
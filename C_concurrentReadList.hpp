@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <new>
+#include <deque>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <limits>
+
+namespace gg
+{
+
+//List with one writer thread and any number of reader threads, readers never block and the writer never waits.
+//Block links and occupancy bitsets are atomics, erasing an element only clears its bit, the element is destroyed
+//and its emptied block is freed later, by an epoch based reclaimer, once no reader can still see them.
+//Readers must iterate inside a read_guard, the writer can iterate and modify the list without one.
+//New elements are only placed after the back element or before the front one, a place is reused once reclaimed.
+template<class T, class TBlockSize=uint16_t>
+class ConcurrentReadList
+{
+    static_assert(std::is_fundamental_v<TBlockSize> && std::is_unsigned_v<TBlockSize>, "TBlockSize must be fundamental and unsigned type !");
+    static_assert(std::atomic<TBlockSize>::is_always_lock_free, "TBlockSize must be lock free as an atomic !");
+
+    struct Block
+    {
+        std::atomic<Block*> _lastBlock{nullptr};
+        std::atomic<Block*> _nextBlock{nullptr};
+        std::atomic<TBlockSize> _occupiedFlags{0};
+        TBlockSize _usedFlags{0}; //Occupied or erased but not yet reclaimed places, only used by the writer
+        alignas(T) uint8_t _data[sizeof(T)*sizeof(TBlockSize)*8];
+    };
+    using BlockIndex = unsigned short;
+
+    struct Retired
+    {
+        Block* _block;
+        BlockIndex _index; //gIndexLast+1 when the whole block is retired
+        uint64_t _epoch;
+    };
+
+    //A reader slot, its epoch is 0 when no reader is inside a read_guard
+    struct ReaderRecord
+    {
+        alignas(64) std::atomic<uint64_t> _epoch{0};
+        std::atomic<bool> _inUse{false};
+        ReaderRecord* _next{nullptr};
+    };
+
+    constexpr static BlockIndex gIndexLast = sizeof(TBlockSize) * 8 - 1;
+    constexpr static BlockIndex gIndexMid = sizeof(TBlockSize) * 8 / 2;
+    constexpr static std::size_t gCollectThreshold = 64;
+
+public:
+    using value_type = T;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = value_type const*;
+        using reference         = value_type const&;
+
+        const_iterator() = default;
+
+        const_iterator& operator++();
+        const_iterator operator++(int) {auto copy=*this; this->operator++(); return copy;}
+
+        [[nodiscard]] reference operator*() const;
+        [[nodiscard]] pointer operator->() const;
+
+        [[nodiscard]] bool operator==(const_iterator const& r) const;
+        [[nodiscard]] bool operator!=(const_iterator const& r) const;
+
+    private:
+        explicit const_iterator(Block* block);
+        const_iterator(Block* block, TBlockSize remainingFlags);
+        void skipEmptyBlocks();
+
+        Block* _block{nullptr};
+        TBlockSize _remainingFlags{0}; //Occupied places of the block not yet visited, read when entering the block
+        BlockIndex _index{0};
+        friend ConcurrentReadList;
+    };
+
+    //Pin the current epoch for a reader, nothing it can reach is reclaimed until the guard is destroyed
+    class read_guard
+    {
+    public:
+        read_guard(read_guard const& r) = delete;
+        read_guard(read_guard&& r) = delete;
+        ~read_guard();
+
+        read_guard& operator=(read_guard const& r) = delete;
+        read_guard& operator=(read_guard&& r) = delete;
+
+        [[nodiscard]] const_iterator begin() const;
+        [[nodiscard]] const_iterator end() const;
+
+    private:
+        explicit read_guard(ConcurrentReadList const* list);
+
+        ConcurrentReadList const* _list;
+        ReaderRecord* _record;
+        friend ConcurrentReadList;
+    };
+
+    ConcurrentReadList();
+    ConcurrentReadList(ConcurrentReadList const& r) = delete;
+    ConcurrentReadList(ConcurrentReadList&& r) = delete;
+    ~ConcurrentReadList();
+
+    ConcurrentReadList& operator=(ConcurrentReadList const& r) = delete;
+    ConcurrentReadList& operator=(ConcurrentReadList&& r) = delete;
+
+    //Reader side
+    [[nodiscard]] read_guard read() const;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    //Writer side
+    template<class U>
+    void push_back(U&& value);
+    template<class... TArgs>
+    T& emplace_back(TArgs&&... value);
+    template<class U>
+    void push_front(U&& value);
+    template<class... TArgs>
+    T& emplace_front(TArgs&&... value);
+
+    const_iterator erase(const_iterator const& pos);
+    template<class TPredicate>
+    std::size_t remove_if(TPredicate predicate);
+    void clear();
+
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+    [[nodiscard]] std::size_t block_count() const noexcept;
+
+    //Destroy and free what no reader can see anymore, return the number of reclaimed elements and blocks
+    std::size_t collect();
+    [[nodiscard]] std::size_t retired_count() const noexcept;
+
+private:
+    [[nodiscard]] Block* allocateBack();
+    [[nodiscard]] Block* allocateFront();
+    void unlinkBlock(Block* block);
+    void retire(Block* block, BlockIndex index);
+    void reclaim(Retired const& retired);
+    void publish(Block* block, BlockIndex index);
+
+    [[nodiscard]] ReaderRecord* acquireRecord() const;
+
+    [[nodiscard]] static BlockIndex lowestIndex(TBlockSize flags);
+    [[nodiscard]] static BlockIndex highestIndex(TBlockSize flags);
+
+    std::atomic<Block*> g_startBlock;
+    Block* g_lastBlock;
+    std::atomic<std::size_t> g_dataSize;
+
+    std::atomic<uint64_t> g_epoch;
+    mutable std::atomic<ReaderRecord*> g_readers;
+    std::deque<Retired> g_retired;
+};
+
+#include "C_concurrentReadList.inl"
+
+}//end gg
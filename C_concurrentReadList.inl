@@ -0,0 +1,496 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//const_iterator
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::const_iterator::const_iterator(Block* block) :
+        _block(block)
+{
+    if (this->_block != nullptr)
+    {
+        this->_remainingFlags = this->_block->_occupiedFlags.load(std::memory_order_acquire);
+        this->skipEmptyBlocks();
+    }
+}
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::const_iterator::const_iterator(Block* block, TBlockSize remainingFlags) :
+        _block(block),
+        _remainingFlags(remainingFlags)
+{
+    this->skipEmptyBlocks();
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator& ConcurrentReadList<T, TBlockSize>::const_iterator::operator++()
+{
+    this->_remainingFlags &= static_cast<TBlockSize>(this->_remainingFlags-1);
+    this->skipEmptyBlocks();
+    return *this;
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator::reference ConcurrentReadList<T, TBlockSize>::const_iterator::operator*() const
+{
+    return reinterpret_cast<T const*>(this->_block->_data)[this->_index];
+}
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator::pointer ConcurrentReadList<T, TBlockSize>::const_iterator::operator->() const
+{
+    return reinterpret_cast<T const*>(this->_block->_data) + this->_index;
+}
+
+template<class T, class TBlockSize>
+bool ConcurrentReadList<T, TBlockSize>::const_iterator::operator==(const_iterator const& r) const
+{
+    return this->_block == r._block && this->_remainingFlags == r._remainingFlags;
+}
+template<class T, class TBlockSize>
+bool ConcurrentReadList<T, TBlockSize>::const_iterator::operator!=(const_iterator const& r) const
+{
+    return this->_block != r._block || this->_remainingFlags != r._remainingFlags;
+}
+
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::const_iterator::skipEmptyBlocks()
+{
+    //An unlinked block keeps its next link, so a reader standing on it can still continue
+    while (this->_block != nullptr && this->_remainingFlags == 0)
+    {
+        this->_block = this->_block->_nextBlock.load(std::memory_order_acquire);
+        if (this->_block != nullptr)
+        {
+            this->_remainingFlags = this->_block->_occupiedFlags.load(std::memory_order_acquire);
+        }
+    }
+    if (this->_block != nullptr)
+    {
+        this->_index = lowestIndex(this->_remainingFlags);
+    }
+}
+
+//read_guard
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::read_guard::read_guard(ConcurrentReadList const* list) :
+        _list(list),
+        _record(list->acquireRecord())
+{
+    //Pairs with the scan of collect(), a RMW on the slot: either the writer sees this epoch or we see its unlinks
+    this->_record->_epoch.exchange(list->g_epoch.load(std::memory_order_acquire), std::memory_order_acq_rel);
+}
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::read_guard::~read_guard()
+{
+    this->_record->_epoch.store(0, std::memory_order_release);
+    this->_record->_inUse.store(false, std::memory_order_release);
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator ConcurrentReadList<T, TBlockSize>::read_guard::begin() const
+{
+    return const_iterator{this->_list->g_startBlock.load(std::memory_order_acquire)};
+}
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator ConcurrentReadList<T, TBlockSize>::read_guard::end() const
+{
+    return const_iterator{};
+}
+
+//ConcurrentReadList
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::ConcurrentReadList() :
+        g_startBlock{new Block},
+        g_lastBlock{g_startBlock.load(std::memory_order_relaxed)},
+        g_dataSize{0},
+        g_epoch{1},
+        g_readers{nullptr}
+{}
+template<class T, class TBlockSize>
+ConcurrentReadList<T, TBlockSize>::~ConcurrentReadList()
+{
+    //No reader can be left, everything is reclaimed
+    for (; !this->g_retired.empty(); this->g_retired.pop_front())
+    {
+        this->reclaim(this->g_retired.front());
+    }
+
+    Block* block = this->g_startBlock.load(std::memory_order_relaxed);
+    while (block != nullptr)
+    {
+        Block* nextBlock = block->_nextBlock.load(std::memory_order_relaxed);
+        this->reclaim(Retired{block, gIndexLast+1, 0});
+        block = nextBlock;
+    }
+
+    ReaderRecord* record = this->g_readers.load(std::memory_order_relaxed);
+    while (record != nullptr)
+    {
+        ReaderRecord* nextRecord = record->_next;
+        delete record;
+        record = nextRecord;
+    }
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::read_guard ConcurrentReadList<T, TBlockSize>::read() const
+{
+    return read_guard{this};
+}
+template<class T, class TBlockSize>
+std::size_t ConcurrentReadList<T, TBlockSize>::size() const noexcept
+{
+    return this->g_dataSize.load(std::memory_order_relaxed);
+}
+template<class T, class TBlockSize>
+bool ConcurrentReadList<T, TBlockSize>::empty() const noexcept
+{
+    return this->g_dataSize.load(std::memory_order_relaxed) == 0;
+}
+
+template<class T, class TBlockSize>
+template<class U>
+void ConcurrentReadList<T, TBlockSize>::push_back(U&& value)
+{
+    this->emplace_back(std::forward<U>(value));
+}
+template<class T, class TBlockSize>
+template<class... TArgs>
+T& ConcurrentReadList<T, TBlockSize>::emplace_back(TArgs&&... value)
+{
+    Block* block = this->g_lastBlock;
+    BlockIndex index = gIndexMid;
+    if (block->_usedFlags != 0)
+    {
+        index = highestIndex(block->_usedFlags) + 1;
+        if (index > gIndexLast)
+        {
+            block = this->allocateBack();
+            index = 0;
+        }
+    }
+
+    T* data = reinterpret_cast<T*>(block->_data) + index;
+    new (data) T(std::forward<TArgs>(value)...);
+    this->publish(block, index);
+    return *data;
+}
+template<class T, class TBlockSize>
+template<class U>
+void ConcurrentReadList<T, TBlockSize>::push_front(U&& value)
+{
+    this->emplace_front(std::forward<U>(value));
+}
+template<class T, class TBlockSize>
+template<class... TArgs>
+T& ConcurrentReadList<T, TBlockSize>::emplace_front(TArgs&&... value)
+{
+    Block* block = this->g_startBlock.load(std::memory_order_relaxed);
+    BlockIndex index = gIndexMid-1;
+    if (block->_usedFlags != 0)
+    {
+        index = lowestIndex(block->_usedFlags);
+        if (index == 0)
+        {
+            block = this->allocateFront();
+            index = gIndexLast;
+        }
+        else
+        {
+            --index;
+        }
+    }
+
+    T* data = reinterpret_cast<T*>(block->_data) + index;
+    new (data) T(std::forward<TArgs>(value)...);
+    this->publish(block, index);
+    return *data;
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator ConcurrentReadList<T, TBlockSize>::erase(const_iterator const& pos)
+{
+    if (pos._block == nullptr)
+    {
+        return pos;
+    }
+
+    Block* block = pos._block;
+    auto const position = static_cast<TBlockSize>(static_cast<TBlockSize>(1) << pos._index);
+
+    //The next iterator is taken before the block can be unlinked and reclaimed
+    const_iterator next{block, static_cast<TBlockSize>(pos._remainingFlags & ~position)};
+
+    auto const flags = static_cast<TBlockSize>(block->_occupiedFlags.load(std::memory_order_relaxed) & ~position);
+    block->_occupiedFlags.store(flags, std::memory_order_release);
+    this->g_dataSize.store(this->g_dataSize.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    this->retire(block, pos._index);
+
+    //The last block of the list is kept even if empty
+    if (flags == 0 && (block->_lastBlock.load(std::memory_order_relaxed) != nullptr || block->_nextBlock.load(std::memory_order_relaxed) != nullptr))
+    {
+        this->unlinkBlock(block);
+    }
+    return next;
+}
+template<class T, class TBlockSize>
+template<class TPredicate>
+std::size_t ConcurrentReadList<T, TBlockSize>::remove_if(TPredicate predicate)
+{
+    std::size_t count = 0;
+    for (auto it = this->begin(); it != this->end();)
+    {
+        if (predicate(*it))
+        {
+            it = this->erase(it);
+            ++count;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return count;
+}
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::clear()
+{
+    //Readers already inside the old chain keep seeing it until they leave
+    Block* block = this->g_startBlock.load(std::memory_order_relaxed);
+    Block* freshBlock = new Block;
+    this->g_startBlock.store(freshBlock, std::memory_order_release);
+    this->g_lastBlock = freshBlock;
+    this->g_dataSize.store(0, std::memory_order_relaxed);
+
+    while (block != nullptr)
+    {
+        Block* nextBlock = block->_nextBlock.load(std::memory_order_relaxed);
+        this->retire(block, gIndexLast+1);
+        block = nextBlock;
+    }
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator ConcurrentReadList<T, TBlockSize>::begin() const
+{
+    return const_iterator{this->g_startBlock.load(std::memory_order_acquire)};
+}
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::const_iterator ConcurrentReadList<T, TBlockSize>::end() const
+{
+    return const_iterator{};
+}
+template<class T, class TBlockSize>
+std::size_t ConcurrentReadList<T, TBlockSize>::block_count() const noexcept
+{
+    std::size_t count = 0;
+    for (Block const* block=this->g_startBlock.load(std::memory_order_acquire); block!=nullptr; block=block->_nextBlock.load(std::memory_order_acquire))
+    {
+        ++count;
+    }
+    return count;
+}
+
+template<class T, class TBlockSize>
+std::size_t ConcurrentReadList<T, TBlockSize>::collect()
+{
+    if (this->g_retired.empty())
+    {
+        return 0;
+    }
+
+    //The slots are read with a RMW so they are ordered with the exchange of read_guard
+    uint64_t oldestEpoch = std::numeric_limits<uint64_t>::max();
+    for (ReaderRecord* record=this->g_readers.load(std::memory_order_acquire); record!=nullptr; record=record->_next)
+    {
+        auto const epoch = record->_epoch.fetch_add(0, std::memory_order_acq_rel);
+        if (epoch != 0 && epoch < oldestEpoch)
+        {
+            oldestEpoch = epoch;
+        }
+    }
+
+    //Everything retired before the oldest pinned epoch can't be seen anymore, retired epochs are in order
+    std::size_t count = 0;
+    for (; !this->g_retired.empty() && this->g_retired.front()._epoch < oldestEpoch; this->g_retired.pop_front())
+    {
+        this->reclaim(this->g_retired.front());
+        ++count;
+    }
+
+    //Readers pinning from now on can't reach what was retired until now
+    this->g_epoch.fetch_add(1, std::memory_order_seq_cst);
+    return count;
+}
+template<class T, class TBlockSize>
+std::size_t ConcurrentReadList<T, TBlockSize>::retired_count() const noexcept
+{
+    return this->g_retired.size();
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::Block* ConcurrentReadList<T, TBlockSize>::allocateBack()
+{
+    Block* lastBlock = this->g_lastBlock;
+    Block* block = new Block;
+    block->_lastBlock.store(lastBlock, std::memory_order_relaxed);
+    lastBlock->_nextBlock.store(block, std::memory_order_release);
+    this->g_lastBlock = block;
+
+    //A kept empty last block, that is now full of places waiting to be reclaimed
+    if (lastBlock->_occupiedFlags.load(std::memory_order_relaxed) == 0)
+    {
+        this->unlinkBlock(lastBlock);
+    }
+    return block;
+}
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::Block* ConcurrentReadList<T, TBlockSize>::allocateFront()
+{
+    Block* startBlock = this->g_startBlock.load(std::memory_order_relaxed);
+    Block* block = new Block;
+    block->_nextBlock.store(startBlock, std::memory_order_relaxed);
+    startBlock->_lastBlock.store(block, std::memory_order_relaxed);
+    this->g_startBlock.store(block, std::memory_order_release);
+
+    if (startBlock->_occupiedFlags.load(std::memory_order_relaxed) == 0)
+    {
+        this->unlinkBlock(startBlock);
+    }
+    return block;
+}
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::unlinkBlock(Block* block)
+{
+    Block* lastBlock = block->_lastBlock.load(std::memory_order_relaxed);
+    Block* nextBlock = block->_nextBlock.load(std::memory_order_relaxed);
+
+    if (lastBlock != nullptr)
+    {
+        lastBlock->_nextBlock.store(nextBlock, std::memory_order_release);
+    }
+    else
+    {
+        this->g_startBlock.store(nextBlock, std::memory_order_release);
+    }
+
+    if (nextBlock != nullptr)
+    {
+        nextBlock->_lastBlock.store(lastBlock, std::memory_order_relaxed);
+    }
+    else
+    {
+        this->g_lastBlock = lastBlock;
+    }
+
+    this->retire(block, gIndexLast+1);
+}
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::retire(Block* block, BlockIndex index)
+{
+    this->g_retired.push_back(Retired{block, index, this->g_epoch.load(std::memory_order_relaxed)});
+    if (this->g_retired.size() % gCollectThreshold == 0)
+    {
+        this->collect();
+    }
+}
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::reclaim(Retired const& retired)
+{
+    Block* block = retired._block;
+    if (retired._index <= gIndexLast)
+    {
+        reinterpret_cast<T*>(block->_data)[retired._index].~T();
+        block->_usedFlags &= static_cast<TBlockSize>(~(static_cast<TBlockSize>(1) << retired._index));
+        return;
+    }
+
+    //The elements erased before were reclaimed first, only the ones still alive are left
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (auto flags = block->_usedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+        {
+            reinterpret_cast<T*>(block->_data)[lowestIndex(flags)].~T();
+        }
+    }
+    delete block;
+}
+template<class T, class TBlockSize>
+void ConcurrentReadList<T, TBlockSize>::publish(Block* block, BlockIndex index)
+{
+    auto const position = static_cast<TBlockSize>(static_cast<TBlockSize>(1) << index);
+    block->_usedFlags |= position;
+
+    //There is only one writer, so a plain store is enough to publish
+    block->_occupiedFlags.store(static_cast<TBlockSize>(block->_occupiedFlags.load(std::memory_order_relaxed) | position), std::memory_order_release);
+    this->g_dataSize.store(this->g_dataSize.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::ReaderRecord* ConcurrentReadList<T, TBlockSize>::acquireRecord() const
+{
+    for (ReaderRecord* record=this->g_readers.load(std::memory_order_acquire); record!=nullptr; record=record->_next)
+    {
+        if (!record->_inUse.load(std::memory_order_relaxed) && !record->_inUse.exchange(true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    //Every record is taken, a new one is pushed in front of them
+    auto* record = new ReaderRecord;
+    record->_inUse.store(true, std::memory_order_relaxed);
+    record->_next = this->g_readers.load(std::memory_order_relaxed);
+    while (!this->g_readers.compare_exchange_weak(record->_next, record, std::memory_order_release, std::memory_order_relaxed))
+    {}
+    return record;
+}
+
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::BlockIndex ConcurrentReadList<T, TBlockSize>::lowestIndex(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(__builtin_ctzll(flags));
+#else
+    BlockIndex index = 0;
+    while ((flags & 1) == 0)
+    {
+        flags >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+template<class T, class TBlockSize>
+typename ConcurrentReadList<T, TBlockSize>::BlockIndex ConcurrentReadList<T, TBlockSize>::highestIndex(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(63 - __builtin_clzll(flags));
+#else
+    BlockIndex index = gIndexLast;
+    while ((flags & (static_cast<TBlockSize>(1) << gIndexLast)) == 0)
+    {
+        flags <<= 1;
+        --index;
+    }
+    return index;
+#endif
+}
@@ -25,15 +25,46 @@
 
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <type_traits>
 #include <iterator>
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <memory>
 
 namespace gg
 {
 
-template<class T, class TBlockSize=uint16_t>
+//A trivially relocatable type can be moved to another address with a memcpy, without calling its destructor.
+//Specialize it for your own types that own resources but don't point to themselves.
+template<class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+template<class T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+template<class T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+enum class Compactions
+{
+    NONE, //Elements stay where they are, only emptied blocks are freed
+    PACK  //Elements are packed into the minimum number of blocks, this invalidate iterators
+};
+
+enum class InsertPolicies
+{
+    SHIFT, //Elements are shifted toward the nearest free place, in the block or its neighbours
+    SPLIT  //A full block is split into two half full blocks, leaving a gap at the insertion point
+};
+
+namespace par
+{
+struct BlockAccess;
+}//end par
+
+template<class T, class TBlockSize=uint16_t, InsertPolicies TInsertPolicy=InsertPolicies::SHIFT>
 class List
 {
     static_assert(std::is_fundamental_v<TBlockSize> && std::is_unsigned_v<TBlockSize>, "TBlockSize must be fundamental and unsigned type !");
@@ -52,7 +83,7 @@ class List
     struct Block
     {
         Block* _lastBlock{nullptr};
-        uint8_t _data[sizeof(T)*sizeof(TBlockSize)*8]{};
+        alignas(T) uint8_t _data[sizeof(T)*sizeof(TBlockSize)*8]{};
         Block* _nextBlock{nullptr};
         TBlockSize _occupiedFlags{0};
     };
@@ -64,6 +95,14 @@ class List
     constexpr static TBlockSize gPositionLast = static_cast<TBlockSize>(1) << gIndexLast;
     constexpr static TBlockSize gPositionMid = static_cast<TBlockSize>(1) << gIndexMid;
 
+    constexpr static bool gIsTriviallyRelocatable = is_trivially_relocatable_v<T>;
+
+    constexpr static std::size_t gSortRunSize = 1024;
+    constexpr static std::size_t gSortBufferMaxSize = 16; //Bigger trivially copyable types are sorted by blocks as the others
+    constexpr static std::size_t gRadixSortThreshold = 512;
+    constexpr static bool gIsRadixSortable = (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8) ||
+                                             (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
     class base_iterator
     {
     public:
@@ -135,13 +174,46 @@ public:
         friend List;
     };
 
+    //Gap buffer over the block chain, free places are kept reserved right before the cursor position.
+    //The list must not be modified by other means while the cursor holds a gap.
+    class insert_cursor
+    {
+    public:
+        insert_cursor(insert_cursor const& r) = delete;
+        constexpr insert_cursor(insert_cursor&& r) noexcept;
+        ~insert_cursor();
+
+        insert_cursor& operator=(insert_cursor const& r) = delete;
+        insert_cursor& operator=(insert_cursor&& r) = delete;
+
+        template<class U>
+        constexpr iterator insert(U&& value);
+        [[nodiscard]] constexpr iterator position() const;
+        constexpr void release();
+
+    private:
+        constexpr insert_cursor(List* list, const_iterator const& pos);
+        constexpr void reserveGap();
+
+        List* _list;
+        const_iterator _pos;
+        Block* _gapBlock{nullptr};
+        BlockIndex _gapIndex{0};
+        friend List;
+    };
+
     constexpr List();
-    template<class TInputIt>
+    template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int> = 0>
     constexpr List(TInputIt first, TInputIt last);
     constexpr List(List const& r);
     constexpr List(List&& r) noexcept;
     constexpr explicit List(std::size_t size);
     constexpr List(std::size_t size, const T& value);
+    //fillFactor is the part of every block that is filled, in (0, 1], larger values are taken as 1 as well as
+    //values that are 0 or less or not a number
+    template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int> = 0>
+    constexpr List(TInputIt first, TInputIt last, float fillFactor);
+    constexpr List(std::size_t size, const T& value, float fillFactor);
     ~List();
 
     constexpr List& operator=(List const& r);
@@ -149,6 +221,17 @@ public:
 
     constexpr void clear();
 
+    constexpr void assign(std::size_t size, T const& value);
+    template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int> = 0>
+    constexpr void assign(TInputIt first, TInputIt last);
+    //Same fillFactor range as the constructors
+    constexpr void assign(std::size_t size, T const& value, float fillFactor);
+    template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int> = 0>
+    constexpr void assign(TInputIt first, TInputIt last, float fillFactor);
+    //Blocks emptied by a shrink are kept to be reused by the next growth, until clear() or shrink_to_fit()
+    constexpr void resize(std::size_t size);
+    constexpr void resize(std::size_t size, T const& value);
+
     template<class U>
     constexpr void push_back(U&& value);
     template<class... TArgs>
@@ -162,12 +245,26 @@ public:
     constexpr void pop_front();
 
     constexpr iterator erase(const_iterator const& pos);
+    constexpr iterator erase(const_iterator first, const_iterator last);
+    template<class TInputIt>
+    constexpr std::size_t erase_many(TInputIt first, TInputIt last);
     template<class U>
     constexpr iterator insert(const_iterator pos, U&& value);
+    //first/last are forward iterators on (position, value) pairs with positions in list order
+    template<class TInputIt>
+    constexpr std::vector<iterator> insert_many(TInputIt first, TInputIt last);
+    [[nodiscard]] constexpr insert_cursor cursor(const_iterator pos);
 
     [[nodiscard]] constexpr std::size_t size() const noexcept;
+    [[nodiscard]] constexpr std::size_t block_count() const noexcept;
     [[nodiscard]] constexpr bool empty() const noexcept;
 
+    //Call function(places, occupiedFlags) for every non empty block, places point to all the places of the block
+    template<class TFunction>
+    constexpr void for_each_block(TFunction&& function);
+    template<class TFunction>
+    constexpr void for_each_block(TFunction&& function) const;
+
     [[nodiscard]] constexpr iterator begin();
     [[nodiscard]] constexpr iterator end();
 
@@ -185,16 +282,120 @@ public:
     constexpr void splice(const_iterator pos, List&& other);
     constexpr void splice(const_iterator pos, List& other, const_iterator it);
     constexpr void splice(const_iterator pos, List&& other, const_iterator it);
+    constexpr void splice(const_iterator pos, List& other, const_iterator first, const_iterator last);
+    constexpr void splice(const_iterator pos, List&& other, const_iterator first, const_iterator last);
+
+    template<class TPredicate>
+    constexpr std::size_t remove_if(TPredicate predicate, Compactions compaction=Compactions::NONE);
+    //value can be an element of this list
+    constexpr std::size_t remove(T const& value, Compactions compaction=Compactions::NONE);
+    constexpr std::size_t unique(Compactions compaction=Compactions::NONE);
+    template<class TBinaryPredicate>
+    constexpr std::size_t unique(TBinaryPredicate predicate, Compactions compaction=Compactions::NONE);
+
+    //Arithmetic types are radix sorted, during a pass the buckets can hold up to 256 partially filled blocks
+    //on top of the list blocks and the sorted list is packed by a last compact() pass.
+    //Small trivially copyable types are sorted in a scratch buffer of the size of the list,
+    //the others are merge sorted by blocks with a few spare blocks.
+    constexpr void sort();
+    template<class TCompare>
+    constexpr void sort(TCompare compare);
+
+    constexpr void merge(List& other);
+    constexpr void merge(List&& other);
+    template<class TCompare>
+    constexpr void merge(List& other, TCompare compare);
+    template<class TCompare>
+    constexpr void merge(List&& other, TCompare compare);
+
+    constexpr void reverse();
+
+    constexpr void compact();
+    constexpr void shrink_to_fit();
+    constexpr std::size_t compact_step(std::size_t maxMoves);
+    //Copied and moved lists take the erase compaction and density floor of their source
+    constexpr void set_erase_compaction(std::size_t maxMoves) noexcept;
+    [[nodiscard]] constexpr std::size_t get_erase_compaction() const noexcept;
+    constexpr void set_density_floor(float floor) noexcept;
+    [[nodiscard]] constexpr float get_density_floor() const noexcept;
 
 private:
+    struct Chain
+    {
+        Block* _first{nullptr};
+        Block* _last{nullptr};
+    };
+    struct ChainWriter
+    {
+        constexpr void write(T* data);
+
+        Block*& _spareBlocks;
+        Chain _chain{};
+        BlockIndex _index{gIndexLast+1};
+    };
+
+    template<bool TAssignable, class THasNext, class TWrite>
+    constexpr void refillElements(THasNext&& hasNext, TWrite&& write);
+    constexpr void trimElements(std::size_t size);
+    template<class THasNext, class TConstruct>
+    constexpr void loadElements(THasNext&& hasNext, TConstruct&& construct, float fillFactor);
+    [[nodiscard]] constexpr static TBlockSize spreadMask(BlockIndex count);
+    template<class TInputIt>
+    constexpr void rebuildBlock(Block* block, std::vector<std::pair<BlockIndex, TInputIt>> const& inserts, std::vector<iterator>& result);
+    constexpr void packRelocatable();
+    constexpr void freeBlocksAfterPacking(Block* writeBlock, BlockIndex writeIndex);
+    constexpr std::size_t compactStep(std::size_t maxMoves, base_iterator* tracked);
+    [[nodiscard]] constexpr static std::size_t mergeCost(Block const* block, Block const* nextBlock, bool intoFirst);
+    constexpr void applyDensityFloor(Block* block, base_iterator* tracked);
+    constexpr Block* mergeBlocks(Block* block, Block* nextBlock, bool intoFirst, base_iterator* tracked);
+    constexpr static void relocateRange(Block* source, BlockIndex sourceIndex, Block* destination, BlockIndex destinationIndex, BlockIndex count);
+    constexpr static void relocateElement(Block* source, BlockIndex sourceIndex, Block* destination, BlockIndex destinationIndex, base_iterator* tracked);
+
+    template<class TPredicate>
+    constexpr std::size_t removeElements(TPredicate&& predicate, Compactions compaction);
+    template<class TCompare>
+    [[nodiscard]] constexpr static Chain mergeChains(Block* left, Block* right, TCompare& compare, Block*& spareBlocks);
+    constexpr void adoptChain(Chain const& chain);
+    constexpr void radixSort();
+    [[nodiscard]] static auto radixKey(T const& value);
+    constexpr static void recycleBlock(Block* block, Block*& spareBlocks);
+    constexpr static void freeSpareBlocks(Block*& spareBlocks);
+
     template<Directions TDirection>
     [[nodiscard]] constexpr DataLocation requestFreePlace();
     template<Directions TDirection>
     constexpr void allocateBlock();
     [[nodiscard]] constexpr static Block* allocateBlock();
+    [[nodiscard]] constexpr Block* takeBlock();
     template<Directions TDirection>
     [[nodiscard]] constexpr Block* insertNewBlock(Block* block);
-    [[nodiscard]] constexpr static BlockIndex shiftBlockToFreeUpSpace(Block* block);
+    [[nodiscard]] constexpr iterator freePlaceBefore(Block* block, BlockIndex index);
+    [[nodiscard]] constexpr iterator splitFullBlock(Block* block, BlockIndex index);
+    template<Directions TDirection>
+    constexpr static void shiftElements(Block* block, BlockIndex first, BlockIndex count);
+    template<Directions TDirection>
+    constexpr static void packBlock(Block* block, base_iterator* tracked);
+    template<Directions TDirection>
+    [[nodiscard]] constexpr static std::size_t packCost(TBlockSize flags);
+    [[nodiscard]] constexpr Block* splitBlock(Block* block, TBlockSize position);
+    [[nodiscard]] constexpr Block* splitBefore(const_iterator const& pos);
+    constexpr void linkChain(Block* before, Block* first, Block* last, std::size_t count);
+    [[nodiscard]] constexpr std::size_t unlinkChain(Block* first, Block* last);
+    constexpr bool unlinkBlock(Block* block);
+    constexpr void freeBlocksAfter(Block* block);
+    constexpr void spareBlocksAfter(Block* block);
+
+    constexpr void refreshCacheFrontIndex();
+    constexpr void refreshCacheBackIndex();
+
+    constexpr static void moveElement(T* destination, T* source);
+    constexpr static void mirrorBlock(Block* block);
+    [[nodiscard]] constexpr static BlockIndex destroyElements(Block* block, TBlockSize mask);
+    [[nodiscard]] constexpr static BlockIndex lowestIndex(TBlockSize flags);
+    [[nodiscard]] constexpr static BlockIndex highestIndex(TBlockSize flags);
+    [[nodiscard]] constexpr static BlockIndex popCount(TBlockSize flags);
+    [[nodiscard]] constexpr static TBlockSize reverseBits(TBlockSize flags);
+    [[nodiscard]] constexpr static TBlockSize rangeMask(BlockIndex index, BlockIndex count);
 
     constexpr void freeBlock(Block* block);
 
@@ -204,8 +405,19 @@ private:
 
     BlockIndex g_cacheFrontIndex;
     BlockIndex g_cacheBackIndex;
+
+    Block* g_compactCursor;
+    std::size_t g_eraseCompactionMoves;
+    float g_densityFloor;
+
+    Block* g_spareBlocks; //Emptied by a shrink, linked by _nextBlock
+
+    friend par::BlockAccess;
 };
 
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy, class TPredicate>
+constexpr std::size_t erase_if(List<T, TBlockSize, TInsertPolicy>& list, TPredicate predicate);
+
 #include "C_list.inl"
 
 }//end gg
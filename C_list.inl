@@ -21,21 +21,27 @@
  * SOFTWARE.
  */
 
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::List() :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List() :
         g_startBlock{nullptr},
         g_lastBlock{nullptr},
         g_dataSize{0},
 
         g_cacheFrontIndex{gIndexMid-1},
-        g_cacheBackIndex{gIndexMid}
+        g_cacheBackIndex{gIndexMid},
+
+        g_compactCursor{nullptr},
+        g_eraseCompactionMoves{0},
+        g_densityFloor{0.0f},
+
+        g_spareBlocks{nullptr}
 {
     this->g_startBlock = this->allocateBlock();
     this->g_lastBlock = this->g_startBlock;
 }
-template<class T, class TBlockSize>
-template<class TInputIt>
-constexpr List<T, TBlockSize>::List(TInputIt first, TInputIt last) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int>>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(TInputIt first, TInputIt last) :
         List()
 {
     for (auto it=first; it!=last; ++it)
@@ -43,32 +49,42 @@ constexpr List<T, TBlockSize>::List(TInputIt first, TInputIt last) :
         this->push_back(*it);
     }
 }
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::List(List const& r) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(List const& r) :
         List()
 {
     for (auto const& value : r)
     {
         this->push_back(value);
     }
+    this->g_eraseCompactionMoves = r.g_eraseCompactionMoves;
+    this->g_densityFloor = r.g_densityFloor;
 }
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::List(List&& r) noexcept :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(List&& r) noexcept :
         g_startBlock{r.g_startBlock},
         g_lastBlock{r.g_lastBlock},
         g_dataSize{r.g_dataSize},
 
         g_cacheFrontIndex{r.g_cacheFrontIndex},
-        g_cacheBackIndex{r.g_cacheBackIndex}
+        g_cacheBackIndex{r.g_cacheBackIndex},
+
+        g_compactCursor{r.g_compactCursor},
+        g_eraseCompactionMoves{r.g_eraseCompactionMoves},
+        g_densityFloor{r.g_densityFloor},
+
+        g_spareBlocks{r.g_spareBlocks}
 {
+    r.g_spareBlocks = nullptr;
     r.g_startBlock = nullptr;
     r.g_lastBlock = nullptr;
     r.g_dataSize = 0;
     r.g_cacheFrontIndex = gIndexMid-1;
     r.g_cacheBackIndex = gIndexMid;
+    r.g_compactCursor = nullptr;
 }
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::List(std::size_t size) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(std::size_t size) :
         List()
 {
     for (std::size_t i=0; i<size; ++i)
@@ -76,8 +92,8 @@ constexpr List<T, TBlockSize>::List(std::size_t size) :
         this->emplace_back();
     }
 }
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::List(std::size_t size, const T& value) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(std::size_t size, const T& value) :
         List()
 {
     for (std::size_t i=0; i<size; ++i)
@@ -85,8 +101,21 @@ constexpr List<T, TBlockSize>::List(std::size_t size, const T& value) :
         this->push_back(value);
     }
 }
-template<class T, class TBlockSize>
-List<T, TBlockSize>::~List()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int>>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(TInputIt first, TInputIt last, float fillFactor) :
+        List()
+{
+    this->assign(first, last, fillFactor);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::List(std::size_t size, const T& value, float fillFactor) :
+        List()
+{
+    this->assign(size, value, fillFactor);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+List<T, TBlockSize, TInsertPolicy>::~List()
 {
     auto* block = this->g_startBlock;
 
@@ -96,106 +125,212 @@ List<T, TBlockSize>::~List()
         this->freeBlock(block);
         block = nextBloc;
     }
+    freeSpareBlocks(this->g_spareBlocks);
 }
 
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>& List<T, TBlockSize>::operator=(List const& r)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>& List<T, TBlockSize, TInsertPolicy>::operator=(List const& r)
 {
     if (this != &r)
     {
-        this->clear();
-        for (auto const& value : r)
-        {
-            this->push_back(value);
-        }
+        this->assign(r.begin(), r.end());
+        this->g_eraseCompactionMoves = r.g_eraseCompactionMoves;
+        this->g_densityFloor = r.g_densityFloor;
     }
     return *this;
 }
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>& List<T, TBlockSize>::operator=(List&& r) noexcept
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>& List<T, TBlockSize, TInsertPolicy>::operator=(List&& r) noexcept
 {
     if (this != &r)
     {
-        this->clear();
+        auto* block = this->g_startBlock;
+        while (block != nullptr)
+        {
+            auto* nextBloc = block->_nextBlock;
+            this->freeBlock(block);
+            block = nextBloc;
+        }
+        freeSpareBlocks(this->g_spareBlocks);
+
+        this->g_spareBlocks = std::exchange(r.g_spareBlocks, nullptr);
         this->g_startBlock = r.g_startBlock;
         this->g_lastBlock = r.g_lastBlock;
         this->g_dataSize = r.g_dataSize;
         this->g_cacheFrontIndex = r.g_cacheFrontIndex;
         this->g_cacheBackIndex = r.g_cacheBackIndex;
+        this->g_compactCursor = r.g_compactCursor;
+        this->g_eraseCompactionMoves = r.g_eraseCompactionMoves;
+        this->g_densityFloor = r.g_densityFloor;
 
         r.g_startBlock = nullptr;
         r.g_lastBlock = nullptr;
         r.g_dataSize = 0;
         r.g_cacheFrontIndex = gIndexMid-1;
         r.g_cacheBackIndex = gIndexMid;
+        r.g_compactCursor = nullptr;
     }
     return *this;
 }
 
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::clear()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::clear()
 {
-    auto* block = this->g_startBlock;
-
-    while (block != nullptr)
-    {
-        auto* nextBloc = block->_nextBlock;
-        this->freeBlock(block);
-        block = nextBloc;
+    if (this->g_startBlock == nullptr)
+    {//Moved from list
+        this->g_startBlock = this->allocateBlock();
+        this->g_lastBlock = this->g_startBlock;
     }
-
-    this->g_startBlock = this->allocateBlock();
-    this->g_lastBlock = this->g_startBlock;
-    this->g_lastBlock->_lastBlock = this->g_lastBlock;
+    else
+    {//The start block is kept for the next elements
+        this->freeBlocksAfter(this->g_startBlock);
+        this->g_dataSize -= destroyElements(this->g_startBlock, std::numeric_limits<TBlockSize>::max());
+    }
+    freeSpareBlocks(this->g_spareBlocks);
 
     this->g_cacheBackIndex = gIndexMid;
     this->g_cacheFrontIndex = gIndexMid-1;
 }
 
-template<class T, class TBlockSize>
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::assign(std::size_t size, T const& value)
+{
+    std::size_t remaining = size;
+    constexpr bool assignable = std::is_copy_assignable_v<T>;
+    this->refillElements<assignable>([&](){ return remaining != 0; },
+                                     [&](T* data, bool occupied)
+                                     {
+                                         if (occupied)
+                                         {
+                                             if constexpr (assignable)
+                                             {
+                                                 *data = value;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             new (data) T(value);
+                                         }
+                                         --remaining;
+                                     });
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int>>
+constexpr void List<T, TBlockSize, TInsertPolicy>::assign(TInputIt first, TInputIt last)
+{
+    constexpr bool assignable = std::is_assignable_v<T&, typename std::iterator_traits<TInputIt>::reference>;
+    this->refillElements<assignable>([&](){ return first != last; },
+                                     [&](T* data, bool occupied)
+                                     {
+                                         if (occupied)
+                                         {
+                                             if constexpr (assignable)
+                                             {
+                                                 *data = *first;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             new (data) T(*first);
+                                         }
+                                         ++first;
+                                     });
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::assign(std::size_t size, T const& value, float fillFactor)
+{
+    std::size_t remaining = size;
+    this->loadElements([&](){ return remaining != 0; },
+                       [&](T* data)
+                       {
+                           new (data) T(value);
+                           --remaining;
+                       },
+                       fillFactor);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt, std::enable_if_t<!std::is_integral_v<TInputIt>, int>>
+constexpr void List<T, TBlockSize, TInsertPolicy>::assign(TInputIt first, TInputIt last, float fillFactor)
+{
+    this->loadElements([&](){ return first != last; },
+                       [&](T* data)
+                       {
+                           new (data) T(*first);
+                           ++first;
+                       },
+                       fillFactor);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::resize(std::size_t size)
+{
+    if (size < this->g_dataSize)
+    {
+        this->trimElements(size);
+        return;
+    }
+    while (this->g_dataSize != size)
+    {
+        this->emplace_back();
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::resize(std::size_t size, T const& value)
+{
+    if (size < this->g_dataSize)
+    {
+        this->trimElements(size);
+        return;
+    }
+    while (this->g_dataSize != size)
+    {
+        this->push_back(value);
+    }
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
 template<class U>
-constexpr void List<T, TBlockSize>::push_back(U&& value)
+constexpr void List<T, TBlockSize, TInsertPolicy>::push_back(U&& value)
 {
     auto* data = this->requestFreePlace<Directions::BACK>()._data;
     new (data) T(std::forward<U>(value));
 }
-template<class T, class TBlockSize>
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
 template<class... TArgs>
-constexpr T& List<T, TBlockSize>::emplace_back(TArgs&&... value)
+constexpr T& List<T, TBlockSize, TInsertPolicy>::emplace_back(TArgs&&... value)
 {
     auto* data = this->requestFreePlace<Directions::BACK>()._data;
     new (data) T(std::forward<TArgs>(value)...);
     return *data;
 }
-template<class T, class TBlockSize>
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
 template<class U>
-constexpr void List<T, TBlockSize>::push_front(U&& value)
+constexpr void List<T, TBlockSize, TInsertPolicy>::push_front(U&& value)
 {
     auto* data = this->requestFreePlace<Directions::FRONT>()._data;
     new (data) T(std::forward<U>(value));
 }
-template<class T, class TBlockSize>
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
 template<class... TArgs>
-constexpr T& List<T, TBlockSize>::emplace_front(TArgs&&... value)
+constexpr T& List<T, TBlockSize, TInsertPolicy>::emplace_front(TArgs&&... value)
 {
     auto* data = this->requestFreePlace<Directions::FRONT>()._data;
     new (data) T(std::forward<TArgs>(value)...);
     return *data;
 }
 
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::pop_back()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::pop_back()
 {
     this->erase(--this->end());
 }
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::pop_front()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::pop_front()
 {
     this->erase(this->begin());
 }
 
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::erase(const_iterator const& pos)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::erase(const_iterator const& pos)
 {
     if (pos._dataLocation._data == nullptr || pos._dataLocation._position == 0)
     {//Nothing to erase
@@ -213,210 +348,254 @@ constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::erase(cons
 
     if (pos._block->_occupiedFlags == 0)
     {//Block can be freed
-        auto* nextBlock = pos._block->_nextBlock;
-        auto* lastBlock = pos._block->_lastBlock;
-
-        if (nextBlock == nullptr && lastBlock == nullptr)
-        {//We can't free the last block
-            this->g_cacheBackIndex = gIndexMid;
-            this->g_cacheFrontIndex = gIndexMid-1;
-            return iteratorNext;
-        }
-
-        if (nextBlock != nullptr && lastBlock != nullptr)
-        {//This block can't be a start or end block
-            nextBlock->_lastBlock = lastBlock;
-            lastBlock->_nextBlock = nextBlock;
-        }
-        else if (lastBlock == nullptr)
-        {
-            nextBlock->_lastBlock = nullptr;
-            this->g_startBlock = nextBlock;
-
-            //Redo the front cache index
-            this->g_cacheFrontIndex = 0;
-            while (this->g_cacheFrontIndex != gIndexLast)
-            {
-                if (nextBlock->_occupiedFlags & (static_cast<TBlockSize>(1)<<this->g_cacheFrontIndex))
-                {
-                    --this->g_cacheFrontIndex;
-                    break;
-                }
-                ++this->g_cacheFrontIndex;
-            }
-        }
-        else if (nextBlock == nullptr)
-        {
-            lastBlock->_nextBlock = nullptr;
-            this->g_lastBlock = lastBlock;
+        this->unlinkBlock(pos._block);
 
-            //Redo the back cache index
-            this->g_cacheBackIndex = gIndexLast;
-            while (this->g_cacheBackIndex != 0)
-            {
-                if (lastBlock->_occupiedFlags & (static_cast<TBlockSize>(1)<<this->g_cacheBackIndex))
-                {
-                    ++this->g_cacheBackIndex;
-                    break;
-                }
-                --this->g_cacheBackIndex;
-            }
+        if (iteratorNext._dataLocation._position == 0)
+        {//The next iterator was the end of the freed block
+            iteratorNext = this->end();
         }
-        delete pos._block;
     }
     else
     {
         //Redo the cache indexes
-        if (pos._block->_nextBlock == nullptr && (pos._dataLocation._position != static_cast<TBlockSize>(1)<<this->g_cacheBackIndex))
+        if (pos._block == this->g_lastBlock)
         {
-            while (this->g_cacheBackIndex != 0)
-            {
-                if (pos._block->_occupiedFlags & (static_cast<TBlockSize>(1)<<this->g_cacheBackIndex))
-                {
-                    ++this->g_cacheBackIndex;
-                    break;
-                }
-                --this->g_cacheBackIndex;
-            }
+            this->refreshCacheBackIndex();
         }
-        else if (pos._block->_lastBlock == nullptr && (pos._dataLocation._position != static_cast<TBlockSize>(1)<<this->g_cacheFrontIndex))
+        if (pos._block == this->g_startBlock)
         {
-            while (this->g_cacheFrontIndex != gIndexLast)
-            {
-                if (pos._block->_occupiedFlags & (static_cast<TBlockSize>(1)<<this->g_cacheFrontIndex))
-                {
-                    --this->g_cacheFrontIndex;
-                    break;
-                }
-                ++this->g_cacheFrontIndex;
-            }
+            this->refreshCacheFrontIndex();
         }
+
+        this->applyDensityFloor(pos._block, &iteratorNext);
     }
 
+    if (this->g_eraseCompactionMoves != 0)
+    {
+        this->compactStep(this->g_eraseCompactionMoves, &iteratorNext);
+    }
     return iteratorNext;
 }
-template<class T, class TBlockSize>
-template<class U>
-constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::insert(const_iterator pos, U&& value)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::erase(const_iterator first, const_iterator last)
 {
-    if (pos._dataLocation._position == 0)
-    {//position is the end so we can just push back
-        pos._dataLocation = this->requestFreePlace<Directions::BACK>();
-        pos._block = this->g_lastBlock;
-        new (pos._dataLocation._data) T(std::forward<U>(value));
-        return pos;
+    if (first == last)
+    {//Nothing to erase
+        return iterator{last};
     }
 
-    //Getting the mask for all bits before the position
-    //ex. position = 0000'1000
-    //    maskBefore = 0000'0111
-    TBlockSize maskBefore = pos._dataLocation._position-1;
-
-    if ((pos._block->_occupiedFlags & maskBefore) == maskBefore)
-    {//We can't insert into the current block as it's full, we have to create a new block or shift last block
-        auto lastBlockInsertIndex = gIndexMid;
-        Block* lastBlock = pos._block->_lastBlock;
+    //Elements are destroyed block by block with a mask, fully covered blocks are freed in the same pass
+    Block* block = first._block;
+    Block* headBlock = first._block;
+    auto mask = static_cast<TBlockSize>(~(first._dataLocation._position-1));
+    while (true)
+    {
+        bool const isLastBlock = block == last._block;
+        if (isLastBlock && last._dataLocation._position != 0)
+        {
+            mask &= static_cast<TBlockSize>(last._dataLocation._position-1);
+        }
 
-        //We can check if we can insert into the last block
-        if (lastBlock == nullptr || lastBlock->_occupiedFlags == std::numeric_limits<TBlockSize>::max())
-        {//Well we can't do that, we have to create a new block
-            lastBlock = this->insertNewBlock<Directions::FRONT>(pos._block);
+        Block* nextBlock = block->_nextBlock;
+        this->g_dataSize -= destroyElements(block, mask);
+        if (block->_occupiedFlags == 0)
+        {
+            if (block == headBlock)
+            {
+                headBlock = nullptr;
+            }
+            this->unlinkBlock(block);
         }
-        else
+        else if (block == this->g_startBlock || block == this->g_lastBlock)
         {
-            lastBlockInsertIndex = shiftBlockToFreeUpSpace(lastBlock);
+            this->refreshCacheFrontIndex();
+            this->refreshCacheBackIndex();
         }
 
-        if (maskBefore == 0)
-        {//We have to insert into the last block
-            ++this->g_dataSize;
-            pos._block = lastBlock;
-            pos._dataLocation._data = reinterpret_cast<T*>(&lastBlock->_data) + lastBlockInsertIndex;
-            pos._dataLocation._position = gPositionFirst << lastBlockInsertIndex;
-            lastBlock->_occupiedFlags |= pos._dataLocation._position;
-            new (pos._dataLocation._data) T(std::forward<U>(value));
-            return pos;
+        if (isLastBlock)
+        {
+            break;
         }
+        block = nextBlock;
+        mask = std::numeric_limits<TBlockSize>::max();
+    }
 
-        //Insert the first value of the block into the last block
-        lastBlock->_occupiedFlags |= gPositionFirst << lastBlockInsertIndex;
-        T* lastBlockData = reinterpret_cast<T*>(&lastBlock->_data) + lastBlockInsertIndex;
-        T* data = reinterpret_cast<T*>(&pos._block->_data);
-        new (lastBlockData) T(std::move(*data));
-        data->~T();
-
-        //Now we can shift the rest of the data
-        for (TBlockSize iPos = gPositionFirst; iPos != pos._dataLocation._position>>1; iPos <<= 1)
+    iterator result = last._dataLocation._position == 0 ? this->end() : iterator{last};
+    if (headBlock != nullptr)
+    {
+        this->applyDensityFloor(headBlock, &result);
+    }
+    if (result._dataLocation._position != 0)
+    {
+        this->applyDensityFloor(result._block, &result);
+    }
+    if (this->g_eraseCompactionMoves != 0)
+    {
+        this->compactStep(this->g_eraseCompactionMoves, &result);
+    }
+    return result;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::erase_many(TInputIt first, TInputIt last)
+{
+    //first/last is a range of const_iterator in any order, consecutive positions on the same block are erased with one mask.
+    //Emptied blocks are only freed at the end as other positions can still point to them
+    std::vector<Block*> emptiedBlocks;
+    std::size_t count = 0;
+    Block* block = nullptr;
+    TBlockSize mask = 0;
+    auto const eraseMask = [&](){
+        if (block == nullptr || (block->_occupiedFlags & mask) == 0)
+        {
+            return;
+        }
+        count += destroyElements(block, mask);
+        if (block->_occupiedFlags == 0)
         {
-            new (data) T(std::move(*(data+1)));
-            ++data;
-            data->~T();
+            emptiedBlocks.push_back(block);
         }
+    };
 
-        //Insert the new value
-        ++this->g_dataSize;
-        pos._dataLocation._position >>= 1;
-        pos._dataLocation._data = data;
-        new (data) T(std::forward<U>(value));
-        return pos;
+    for (auto it=first; it!=last; ++it)
+    {
+        const_iterator const& pos = *it;
+        if (pos._dataLocation._position == 0)
+        {//Nothing to erase
+            continue;
+        }
+        if (pos._block != block)
+        {
+            eraseMask();
+            block = pos._block;
+            mask = 0;
+        }
+        mask |= pos._dataLocation._position;
     }
+    eraseMask();
+    this->g_dataSize -= count;
 
-    if (!(pos._block->_occupiedFlags & pos._dataLocation._position>>1))
-    {//We have the place to insert it just before the current position
-        ++this->g_dataSize;
-        pos._dataLocation._position >>= 1;
-        pos._block->_occupiedFlags |= pos._dataLocation._position;
-        --pos._dataLocation._data;
-
+    for (Block* emptiedBlock : emptiedBlocks)
+    {
+        this->unlinkBlock(emptiedBlock);
+    }
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+    return count;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class U>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::insert(const_iterator pos, U&& value)
+{
+    if (pos._dataLocation._position == 0)
+    {//position is the end so we can just push back
+        pos._dataLocation = this->requestFreePlace<Directions::BACK>();
+        pos._block = this->g_lastBlock;
         new (pos._dataLocation._data) T(std::forward<U>(value));
         return pos;
     }
 
-    TBlockSize notOccupiedBefore = ~pos._block->_occupiedFlags & maskBefore;
+    iterator place = this->freePlaceBefore(pos._block, lowestIndex(pos._dataLocation._position));
+    new (place._dataLocation._data) T(std::forward<U>(value));
+    place._block->_occupiedFlags |= place._dataLocation._position;
+    ++this->g_dataSize;
 
-    //We have to shift data inside the current block
-    TBlockSize position = gPositionFirst;
-    T* data = reinterpret_cast<T*>(pos._block->_data);
-    do
-    {
-        notOccupiedBefore &=~ position;
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+    return place;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt>
+constexpr std::vector<typename List<T, TBlockSize, TInsertPolicy>::iterator> List<T, TBlockSize, TInsertPolicy>::insert_many(TInputIt first, TInputIt last)
+{
+    //first/last is a range of (position, value) pairs with positions in list order,
+    //inserts are grouped by block and every block is rebuilt once
+    static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<TInputIt>::iterator_category>,
+                  "insert_many() reads the values once the inserts of a block are grouped, it needs forward iterators");
+    std::vector<iterator> result;
+    result.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    std::vector<std::pair<BlockIndex, TInputIt>> inserts;
+    Block* block = nullptr;
 
-        if (notOccupiedBefore == 0)
-        {//We are in the last not occupied place
-            pos._block->_occupiedFlags |= position;
-            new (data) T(std::move(*(data+1)));
-            ++data;
-            data->~T();
-        }
-        else
+    for (auto it=first; it!=last; ++it)
+    {
+        const_iterator const& pos = it->first;
+        Block* const posBlock = pos._block;
+        if (posBlock != block)
         {
-            ++data;
+            if (block != nullptr)
+            {
+                this->rebuildBlock(block, inserts, result);
+                inserts.clear();
+            }
+            block = posBlock;
         }
-
-        position <<= 1;
+        //The end is after every place of the last block
+        inserts.emplace_back(pos._dataLocation._position == 0 ? gIndexLast+1 : lowestIndex(pos._dataLocation._position), it);
+    }
+    if (block != nullptr)
+    {
+        this->rebuildBlock(block, inserts, result);
     }
-    while (position != pos._dataLocation._position>>1);
 
-    ++this->g_dataSize;
-    pos._dataLocation._position = position;
-    pos._dataLocation._data = data;
-    new (data) T(std::forward<U>(value));
-    return pos;
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+    return result;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::insert_cursor List<T, TBlockSize, TInsertPolicy>::cursor(const_iterator pos)
+{
+    return insert_cursor{this, pos};
 }
 
-template<class T, class TBlockSize>
-constexpr std::size_t List<T, TBlockSize>::size() const noexcept
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::size() const noexcept
 {
     return this->g_dataSize;
 }
-template<class T, class TBlockSize>
-constexpr bool List<T, TBlockSize>::empty() const noexcept
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::block_count() const noexcept
+{
+    std::size_t count = 0;
+    for (Block const* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        ++count;
+    }
+    return count;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr bool List<T, TBlockSize, TInsertPolicy>::empty() const noexcept
 {
     return this->g_dataSize == 0;
 }
 
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::begin()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TFunction>
+constexpr void List<T, TBlockSize, TInsertPolicy>::for_each_block(TFunction&& function)
+{
+    for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        if (block->_occupiedFlags != 0)
+        {
+            function(reinterpret_cast<T*>(block->_data), block->_occupiedFlags);
+        }
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TFunction>
+constexpr void List<T, TBlockSize, TInsertPolicy>::for_each_block(TFunction&& function) const
+{
+    for (Block const* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        if (block->_occupiedFlags != 0)
+        {
+            function(reinterpret_cast<T const*>(block->_data), block->_occupiedFlags);
+        }
+    }
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::begin()
 {
     DataLocation location{reinterpret_cast<T*>(&this->g_startBlock->_data), gPositionFirst};
     do
@@ -433,13 +612,13 @@ constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::begin()
 
     return iterator{this->g_startBlock, location};
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::iterator List<T, TBlockSize>::end()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::end()
 {
     return iterator{this->g_lastBlock};
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::const_iterator List<T, TBlockSize>::begin() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::const_iterator List<T, TBlockSize, TInsertPolicy>::begin() const
 {
     DataLocation location{reinterpret_cast<T*>(&this->g_startBlock->_data), gPositionFirst};
     do
@@ -456,63 +635,85 @@ constexpr typename List<T, TBlockSize>::const_iterator List<T, TBlockSize>::begi
 
     return const_iterator{this->g_startBlock, location};
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::const_iterator List<T, TBlockSize>::cbegin() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::const_iterator List<T, TBlockSize, TInsertPolicy>::cbegin() const
 {
     return this->begin();
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::const_iterator List<T, TBlockSize>::end() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::const_iterator List<T, TBlockSize, TInsertPolicy>::end() const
 {
     return const_iterator{this->g_lastBlock};
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::const_iterator List<T, TBlockSize>::cend() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::const_iterator List<T, TBlockSize, TInsertPolicy>::cend() const
 {
     return this->end();
 }
 
-template<class T, class TBlockSize>
-constexpr T& List<T, TBlockSize>::front()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr T& List<T, TBlockSize, TInsertPolicy>::front()
 {
     return *this->begin();
 }
-template<class T, class TBlockSize>
-constexpr T const& List<T, TBlockSize>::front() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr T const& List<T, TBlockSize, TInsertPolicy>::front() const
 {
     return *this->begin();
 }
-template<class T, class TBlockSize>
-constexpr T& List<T, TBlockSize>::back()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr T& List<T, TBlockSize, TInsertPolicy>::back()
 {
     return *--this->end();
 }
-template<class T, class TBlockSize>
-constexpr T const& List<T, TBlockSize>::back() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr T const& List<T, TBlockSize, TInsertPolicy>::back() const
 {
     return *--this->end();
 }
 
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::splice(const_iterator pos, List& other)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List& other)
 {
-    for (auto& data : other)
-    {
-        this->insert(pos, std::move(data));
+    if (this == &other || other.g_dataSize == 0)
+    {//Nothing to splice
+        return;
+    }
+
+    if (this->g_dataSize == 0)
+    {//We are empty, so we can just swap the chains, the other list will take our empty block
+        std::swap(this->g_startBlock, other.g_startBlock);
+        std::swap(this->g_lastBlock, other.g_lastBlock);
+        std::swap(this->g_dataSize, other.g_dataSize);
+        std::swap(this->g_cacheFrontIndex, other.g_cacheFrontIndex);
+        std::swap(this->g_cacheBackIndex, other.g_cacheBackIndex);
+        std::swap(this->g_compactCursor, other.g_compactCursor);
+        return;
     }
-    other.clear();
+
+    //At most one block worth of elements is moved here
+    Block* before = this->splitBefore(pos);
+
+    Block* first = other.g_startBlock;
+    Block* last = other.g_lastBlock;
+    std::size_t const count = other.g_dataSize;
+
+    other.g_startBlock = other.allocateBlock();
+    other.g_lastBlock = other.g_startBlock;
+    other.g_dataSize = 0;
+    other.g_cacheFrontIndex = gIndexMid-1;
+    other.g_cacheBackIndex = gIndexMid;
+    other.g_compactCursor = nullptr;
+
+    this->linkChain(before, first, last, count);
 }
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::splice(const_iterator pos, List&& other)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List&& other)
 {
-    for (auto& data : other)
-    {
-        this->insert(pos, std::move(data));
-    }
-    other.clear();
+    this->splice(pos, other);
 }
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::splice(const_iterator pos, List& other, const_iterator it)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List& other, const_iterator it)
 {
     if (this == &other)
     {//In order to avoid invalidating the "it" iterator, we must use a temporary variable
@@ -525,8 +726,8 @@ constexpr void List<T, TBlockSize>::splice(const_iterator pos, List& other, cons
     this->insert(pos, std::move(const_cast<T&>(*it)));
     other.erase(it);
 }
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::splice(const_iterator pos, List&& other, const_iterator it)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List&& other, const_iterator it)
 {
     if (this == &other)
     {//In order to avoid invalidating the "it" iterator, we must use a temporary variable
@@ -540,192 +741,1892 @@ constexpr void List<T, TBlockSize>::splice(const_iterator pos, List&& other, con
     other.erase(it);
 }
 
-template<class T, class TBlockSize>
-template<typename List<T, TBlockSize>::Directions TDirection>
-constexpr typename List<T, TBlockSize>::DataLocation List<T, TBlockSize>::requestFreePlace()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List& other, const_iterator first, const_iterator last)
 {
-    if constexpr (TDirection == Directions::FRONT)
-    {
-        if (this->g_cacheFrontIndex > gIndexLast)
-        {//We have to allocate a new block as the index is out of range
-            this->allocateBlock<Directions::FRONT>();
-            this->g_cacheFrontIndex = gIndexLast;
-        }
-
-        DataLocation data{
-            reinterpret_cast<T*>(&this->g_startBlock->_data)+this->g_cacheFrontIndex,
-            static_cast<TBlockSize>(static_cast<TBlockSize>(1)<<this->g_cacheFrontIndex)
-        };
-
-        this->g_startBlock->_occupiedFlags |= data._position;
-        --this->g_cacheFrontIndex;
-
-        ++this->g_dataSize;
+    if (first == last)
+    {//Nothing to splice
+        return;
+    }
 
-        return data;
+    //Make sure that the range is only made of whole blocks, only the partial head and tail blocks are moving elements
+    Block* rangeFirst = other.splitBefore(first);
+    if (last._block == first._block && last._dataLocation._position >= first._dataLocation._position)
+    {
+        last._block = rangeFirst;
     }
-    else
+    if (pos._block == first._block && pos._dataLocation._position >= first._dataLocation._position)
     {
-        if (this->g_cacheBackIndex > gIndexLast)
-        {//We have to allocate a new block as the index is out of range
-            this->allocateBlock<Directions::BACK>();
-            this->g_cacheBackIndex = 0;
-        }
+        pos._block = rangeFirst;
+    }
 
-        DataLocation data{
-            reinterpret_cast<T*>(&this->g_lastBlock->_data)+this->g_cacheBackIndex,
-            static_cast<TBlockSize>(static_cast<TBlockSize>(1)<<this->g_cacheBackIndex)
-        };
+    Block* rangeEnd = other.splitBefore(last);
+    if (rangeEnd != nullptr && pos._block == last._block && pos._dataLocation._position >= last._dataLocation._position)
+    {
+        pos._block = rangeEnd;
+    }
 
-        this->g_lastBlock->_occupiedFlags |= data._position;
-        ++this->g_cacheBackIndex;
+    Block* before = this->splitBefore(pos);
 
-        ++this->g_dataSize;
+    //Relink the whole blocks
+    Block* rangeLast = rangeEnd == nullptr ? other.g_lastBlock : rangeEnd->_lastBlock;
+    std::size_t const count = other.unlinkChain(rangeFirst, rangeLast);
+    this->linkChain(before, rangeFirst, rangeLast, count);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::splice(const_iterator pos, List&& other, const_iterator first, const_iterator last)
+{
+    this->splice(pos, other, first, last);
+}
 
-        return data;
-    }
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TPredicate>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::remove_if(TPredicate predicate, Compactions compaction)
+{
+    return this->removeElements([&predicate]([[maybe_unused]] T const* previous, T& value){
+        return static_cast<bool>(predicate(value));
+    }, compaction);
 }
-template<class T, class TBlockSize>
-template<typename List<T, TBlockSize>::Directions TDirection>
-constexpr void List<T, TBlockSize>::allocateBlock()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::remove(T const& value, Compactions compaction)
 {
-    if constexpr (TDirection == Directions::FRONT)
+    //value can be an element of this list, it is then kept in place until nothing is compared to it anymore
+    Block* valueBlock = this->g_startBlock;
+    for (; valueBlock != nullptr; valueBlock = valueBlock->_nextBlock)
     {
-        auto* oldBlock = this->g_startBlock;
-
-        this->g_startBlock = this->allocateBlock();
-
-        this->g_startBlock->_nextBlock = oldBlock;
-        oldBlock->_lastBlock = this->g_startBlock;
+        T const* data = reinterpret_cast<T const*>(&valueBlock->_data);
+        if (!std::less<>{}(&value, data) && std::less<>{}(&value, data + gIndexLast+1))
+        {
+            break;
+        }
     }
-    else
+
+    if (valueBlock == nullptr)
     {
-        auto* oldBlock = this->g_lastBlock;
+        return this->removeElements([&value]([[maybe_unused]] T const* previous, T& element){
+            return static_cast<bool>(element == value);
+        }, compaction);
+    }
 
-        this->g_lastBlock = this->allocateBlock();
+    std::size_t count = this->removeElements([&value]([[maybe_unused]] T const* previous, T& element){
+        return &element != &value && static_cast<bool>(element == value);
+    }, Compactions::NONE);
+    if (static_cast<bool>(value == value))
+    {
+        auto const index = static_cast<BlockIndex>(&value - reinterpret_cast<T const*>(&valueBlock->_data));
+        this->g_dataSize -= destroyElements(valueBlock, static_cast<TBlockSize>(gPositionFirst << index));
+        ++count;
+        if (valueBlock->_occupiedFlags == 0)
+        {
+            this->unlinkBlock(valueBlock);
+        }
+    }
 
-        this->g_lastBlock->_lastBlock = oldBlock;
-        oldBlock->_nextBlock = this->g_lastBlock;
+    if (compaction == Compactions::PACK)
+    {
+        this->compact();
     }
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+    return count;
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::Block* List<T, TBlockSize>::allocateBlock()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::unique(Compactions compaction)
 {
-    return new Block{};
+    return this->removeElements([](T const* previous, T& value){
+        return previous != nullptr && static_cast<bool>(*previous == value);
+    }, compaction);
 }
-template<class T, class TBlockSize>
-template<typename List<T, TBlockSize>::Directions TDirection>
-constexpr typename List<T, TBlockSize>::Block* List<T, TBlockSize>::insertNewBlock(Block* block)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TBinaryPredicate>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::unique(TBinaryPredicate predicate, Compactions compaction)
 {
-    if constexpr (TDirection == Directions::FRONT)
-    {
-        auto* oldBlock = block->_lastBlock;
-
-        block->_lastBlock = this->allocateBlock();
-
-        block->_lastBlock->_nextBlock = block;
-        block->_lastBlock->_lastBlock = oldBlock;
+    return this->removeElements([&predicate](T const* previous, T& value){
+        return previous != nullptr && static_cast<bool>(predicate(*previous, value));
+    }, compaction);
+}
 
-        if (oldBlock == nullptr)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::sort()
+{
+    if constexpr (gIsRadixSortable)
+    {
+        if (this->g_dataSize >= gRadixSortThreshold)
         {
-            this->g_startBlock = block->_lastBlock;
+            this->radixSort();
+            return;
         }
-        else
+    }
+    this->sort(std::less<>{});
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TCompare>
+constexpr void List<T, TBlockSize, TInsertPolicy>::sort(TCompare compare)
+{
+    if (this->g_dataSize < 2)
+    {
+        return;
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= gSortBufferMaxSize)
+    {//Gather everything in a scratch buffer, sort it and write it back packed in the same blocks
+        std::vector<T> buffer;
+        buffer.reserve(this->g_dataSize);
+        for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+        {
+            T const* data = reinterpret_cast<T const*>(&block->_data);
+            for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+            {
+                buffer.push_back(data[lowestIndex(flags)]);
+            }
+        }
+
+        std::stable_sort(buffer.begin(), buffer.end(), compare);
+
+        Block* block = this->g_startBlock;
+        for (std::size_t i=0; i<buffer.size(); block = block->_nextBlock)
+        {
+            std::size_t const count = std::min<std::size_t>(buffer.size()-i, gIndexLast+1);
+            std::copy_n(buffer.data()+i, count, reinterpret_cast<T*>(&block->_data));
+            block->_occupiedFlags = count > gIndexLast ? std::numeric_limits<TBlockSize>::max() :
+                                    static_cast<TBlockSize>((gPositionFirst << count) - 1);
+            i += count;
+            if (i == buffer.size())
+            {
+                for (Block* nextBlock = block->_nextBlock; nextBlock != nullptr; nextBlock = nextBlock->_nextBlock)
+                {//Their elements are already in the buffer, freeing must not count them again
+                    nextBlock->_occupiedFlags = 0;
+                }
+                this->freeBlocksAfter(block);
+            }
+        }
+    }
+    else
+    {
+        //Sorted runs are made by sorting pointers to a group of blocks and moving the elements once into a new chain
+        Block* spareBlocks = nullptr;
+        std::vector<T*> run;
+        run.reserve(gSortRunSize + gIndexLast);
+
+        Chain bins[64]{};
+        Block* block = this->g_startBlock;
+        while (block != nullptr)
+        {
+            Block* groupFirst = block;
+            run.clear();
+            do
+            {
+                T* data = reinterpret_cast<T*>(&block->_data);
+                for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+                {
+                    run.push_back(data + lowestIndex(flags));
+                }
+                block = block->_nextBlock;
+            }
+            while (block != nullptr && run.size() < gSortRunSize);
+
+            std::stable_sort(run.begin(), run.end(), [&compare](T const* a, T const* b){
+                return compare(*a, *b);
+            });
+
+            ChainWriter writer{spareBlocks};
+            for (T* data : run)
+            {
+                writer.write(data);
+            }
+            while (groupFirst != block)
+            {
+                Block* nextBlock = groupFirst->_nextBlock;
+                recycleBlock(groupFirst, spareBlocks);
+                groupFirst = nextBlock;
+            }
+
+            //Merge runs of the same size like a binary counter, older runs are always on the left for stability
+            Chain carry = writer._chain;
+            std::size_t bin = 0;
+            for (; bins[bin]._first != nullptr; ++bin)
+            {
+                carry = mergeChains(bins[bin]._first, carry._first, compare, spareBlocks);
+                bins[bin] = Chain{};
+            }
+            bins[bin] = carry;
+        }
+
+        Chain result{};
+        for (auto const& chain : bins)
+        {
+            if (chain._first != nullptr)
+            {
+                result = result._first == nullptr ? chain : mergeChains(chain._first, result._first, compare, spareBlocks);
+            }
+        }
+        freeSpareBlocks(spareBlocks);
+        this->adoptChain(result);
+    }
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::merge(List& other)
+{
+    this->merge(other, std::less<>{});
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::merge(List&& other)
+{
+    this->merge(other, std::less<>{});
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TCompare>
+constexpr void List<T, TBlockSize, TInsertPolicy>::merge(List& other, TCompare compare)
+{
+    if (this == &other || other.g_dataSize == 0)
+    {
+        return;
+    }
+    if (this->g_dataSize == 0)
+    {
+        this->splice(this->end(), other);
+        return;
+    }
+
+    std::size_t const size = this->g_dataSize + other.g_dataSize;
+    Block* otherFirst = other.g_startBlock;
+
+    other.g_startBlock = other.allocateBlock();
+    other.g_lastBlock = other.g_startBlock;
+    other.g_dataSize = 0;
+    other.g_cacheFrontIndex = gIndexMid-1;
+    other.g_cacheBackIndex = gIndexMid;
+    other.g_compactCursor = nullptr;
+
+    Block* spareBlocks = nullptr;
+    this->adoptChain(mergeChains(this->g_startBlock, otherFirst, compare, spareBlocks));
+    freeSpareBlocks(spareBlocks);
+    this->g_dataSize = size;
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TCompare>
+constexpr void List<T, TBlockSize, TInsertPolicy>::merge(List&& other, TCompare compare)
+{
+    this->merge(other, std::move(compare));
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::reverse()
+{
+    //Every block keep its elements, only the links and the order inside the block are reversed
+    Block* block = this->g_startBlock;
+    while (block != nullptr)
+    {
+        Block* nextBlock = block->_nextBlock;
+        std::swap(block->_lastBlock, block->_nextBlock);
+        mirrorBlock(block);
+        block = nextBlock;
+    }
+    std::swap(this->g_startBlock, this->g_lastBlock);
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::compact()
+{
+    if constexpr (gIsTriviallyRelocatable)
+    {
+        this->packRelocatable();
+    }
+    else
+    {
+        this->removeElements([]([[maybe_unused]] T const* previous, [[maybe_unused]] T& value){
+            return false;
+        }, Compactions::PACK);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::shrink_to_fit()
+{
+    this->compact();
+    freeSpareBlocks(this->g_spareBlocks);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::compact_step(std::size_t maxMoves)
+{
+    return this->compactStep(maxMoves, nullptr);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::set_erase_compaction(std::size_t maxMoves) noexcept
+{
+    this->g_eraseCompactionMoves = maxMoves;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::get_erase_compaction() const noexcept
+{
+    return this->g_eraseCompactionMoves;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::set_density_floor(float floor) noexcept
+{
+    this->g_densityFloor = floor;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr float List<T, TBlockSize, TInsertPolicy>::get_density_floor() const noexcept
+{
+    return this->g_densityFloor;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TAssignable, class THasNext, class TWrite>
+constexpr void List<T, TBlockSize, TInsertPolicy>::refillElements(THasNext&& hasNext, TWrite&& write)
+{
+    //Blocks are refilled from their first place, existing elements are assigned and free places constructed
+    Block* block = this->g_startBlock;
+    while (block != nullptr)
+    {
+        T* data = reinterpret_cast<T*>(&block->_data);
+        for (BlockIndex i=0; i<=gIndexLast; ++i)
+        {
+            TBlockSize const position = static_cast<TBlockSize>(gPositionFirst << i);
+            if (!hasNext())
+            {
+                if (i == 0 && block != this->g_startBlock)
+                {//This block would be empty
+                    block = block->_lastBlock;
+                }
+                else
+                {
+                    this->g_dataSize -= destroyElements(block, static_cast<TBlockSize>(~(position-1)));
+                }
+                this->spareBlocksAfter(block);
+
+                this->refreshCacheFrontIndex();
+                this->refreshCacheBackIndex();
+                return;
+            }
+
+            bool occupied = (block->_occupiedFlags & position) != 0;
+            if constexpr (!TAssignable)
+            {
+                if (occupied)
+                {//The element can't be assigned, it is destroyed and constructed again
+                    this->g_dataSize -= destroyElements(block, position);
+                    occupied = false;
+                }
+            }
+            write(data+i, occupied);
+            if (!occupied)
+            {
+                block->_occupiedFlags |= position;
+                ++this->g_dataSize;
+            }
+        }
+        block = block->_nextBlock;
+    }
+
+    //Every block is full, the remaining elements extend the list at the back
+    this->refreshCacheFrontIndex();
+    this->g_cacheBackIndex = gIndexLast+1;
+    while (hasNext())
+    {
+        write(this->requestFreePlace<Directions::BACK>()._data, false);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class THasNext, class TConstruct>
+constexpr void List<T, TBlockSize, TInsertPolicy>::loadElements(THasNext&& hasNext, TConstruct&& construct, float fillFactor)
+{
+    //Every element is destroyed, then the blocks are refilled only at the places of an evenly spread mask
+    //so a free place is left right before some elements for future inserts
+    for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        this->g_dataSize -= destroyElements(block, std::numeric_limits<TBlockSize>::max());
+    }
+
+    if (!(fillFactor > 0.0f))
+    {//Also true for NaN, that can't be clamped
+        fillFactor = 1.0f;
+    }
+    auto const count = static_cast<BlockIndex>(std::clamp(fillFactor * static_cast<float>(gIndexLast+1) + 0.5f,
+                                                          1.0f, static_cast<float>(gIndexLast+1)));
+    TBlockSize const mask = spreadMask(count);
+
+    Block* block = this->g_startBlock;
+    while (hasNext())
+    {
+        if (block->_occupiedFlags != 0)
+        {
+            if (block->_nextBlock == nullptr)
+            {
+                this->allocateBlock<Directions::BACK>();
+            }
+            block = block->_nextBlock;
+        }
+
+        for (TBlockSize flags = mask; flags != 0 && hasNext(); flags &= static_cast<TBlockSize>(flags-1))
+        {
+            auto const index = lowestIndex(flags);
+            construct(reinterpret_cast<T*>(&block->_data) + index);
+            block->_occupiedFlags |= static_cast<TBlockSize>(gPositionFirst << index);
+            ++this->g_dataSize;
+        }
+    }
+    this->spareBlocksAfter(block);
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr TBlockSize List<T, TBlockSize, TInsertPolicy>::spreadMask(BlockIndex count)
+{
+    //count places evenly spread over the block, the last place is always used
+    TBlockSize mask = 0;
+    for (std::size_t i=1; i<=count; ++i)
+    {
+        mask |= static_cast<TBlockSize>(gPositionFirst << (i*(gIndexLast+1)/count - 1));
+    }
+    return mask;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TInputIt>
+constexpr void List<T, TBlockSize, TInsertPolicy>::rebuildBlock(Block* block, std::vector<std::pair<BlockIndex, TInputIt>> const& inserts, std::vector<iterator>& result)
+{
+    //Elements before the first insert stay in place, the others and the new ones are packed after them,
+    //then in the free places at the head of the next block and then in the new blocks needed after this one.
+    //If it saves a new block, the packing starts in the free places at the tail of the previous block instead.
+    constexpr std::size_t blockSize = gIndexLast+1;
+    TBlockSize kept = block->_occupiedFlags & rangeMask(0, inserts.front().first);
+    std::size_t start = kept == 0 ? 0 : highestIndex(kept)+1;
+    std::size_t count = popCount(static_cast<TBlockSize>(block->_occupiedFlags &~ kept)) + inserts.size();
+
+    Block* const nextBlock = block->_nextBlock;
+    std::size_t const capacity = blockSize + (nextBlock == nullptr ? 0 :
+            (nextBlock->_occupiedFlags == 0 ? blockSize : lowestIndex(nextBlock->_occupiedFlags)));
+    std::size_t overflow = start + count > capacity ? start + count - capacity : 0;
+
+    Block* target = block;
+    Block* const previousBlock = block->_lastBlock;
+    if (overflow != 0 && previousBlock != nullptr)
+    {
+        std::size_t const tailFree = previousBlock->_occupiedFlags == 0 ? blockSize :
+                gIndexLast - highestIndex(previousBlock->_occupiedFlags);
+        std::size_t const previousCount = count + popCount(kept);
+        std::size_t const previousOverflow = previousCount > tailFree + capacity ? previousCount - tailFree - capacity : 0;
+        if ((previousOverflow + blockSize-1) / blockSize < (overflow + blockSize-1) / blockSize)
+        {
+            target = previousBlock;
+            start = blockSize - tailFree;
+            kept = 0;
+            count = previousCount;
+            overflow = previousOverflow;
+        }
+    }
+    TBlockSize const moved = block->_occupiedFlags &~ kept;
+
+    Block* newBlock = block;
+    for (std::size_t i=(overflow + blockSize-1) / blockSize; i!=0; --i)
+    {
+        newBlock = this->insertNewBlock<Directions::BACK>(newBlock);
+    }
+
+    //Moved elements wait in a spare block (it stays a spare), so they are written in list order without overlapping
+    if (this->g_spareBlocks == nullptr)
+    {
+        this->g_spareBlocks = allocateBlock();
+    }
+    T* const waiting = reinterpret_cast<T*>(&this->g_spareBlocks->_data);
+    T* const data = reinterpret_cast<T*>(&block->_data);
+    BlockIndex waitingCount = 0;
+    for (TBlockSize flags = moved; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+    {
+        moveElement(waiting + waitingCount++, data + lowestIndex(flags));
+    }
+    block->_occupiedFlags &=~ moved;
+
+    auto targetIndex = static_cast<BlockIndex>(start);
+    auto const takePlace = [&](){
+        if (targetIndex > gIndexLast)
+        {
+            target = target->_nextBlock;
+            targetIndex = 0;
+        }
+        DataLocation const location{reinterpret_cast<T*>(&target->_data) + targetIndex, static_cast<TBlockSize>(gPositionFirst << targetIndex)};
+        ++targetIndex;
+        return location;
+    };
+
+    //New elements are constructed once everything is moved, only their places are taken here
+    std::size_t const firstResult = result.size();
+    auto insert = inserts.begin();
+    waitingCount = 0;
+    for (TBlockSize flags = moved; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+    {
+        for (auto const index = lowestIndex(flags); insert != inserts.end() && insert->first <= index; ++insert)
+        {
+            DataLocation const location = takePlace();
+            result.emplace_back(target, location);
+        }
+        DataLocation const location = takePlace();
+        moveElement(location._data, waiting + waitingCount++);
+        target->_occupiedFlags |= location._position;
+    }
+    for (; insert != inserts.end(); ++insert)
+    {
+        DataLocation const location = takePlace();
+        result.emplace_back(target, location);
+    }
+
+    if (block->_occupiedFlags == 0 && target != block && target->_nextBlock == block)
+    {//Everything was packed in the previous block
+        this->unlinkBlock(block);
+    }
+
+    for (std::size_t i=0; i<inserts.size(); ++i)
+    {
+        iterator const& place = result[firstResult+i];
+        new (place._dataLocation._data) T((*inserts[i].second).second);
+        place._block->_occupiedFlags |= place._dataLocation._position;
+        ++this->g_dataSize;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::trimElements(std::size_t size)
+{
+    //Find the block holding the last kept element, everything after it is destroyed
+    Block* block = this->g_startBlock;
+    std::size_t remaining = size;
+    while (block->_nextBlock != nullptr && popCount(block->_occupiedFlags) <= remaining)
+    {
+        remaining -= popCount(block->_occupiedFlags);
+        block = block->_nextBlock;
+    }
+
+    if (remaining == 0 && block != this->g_startBlock)
+    {//Nothing is kept in this block
+        block = block->_lastBlock;
+    }
+    else
+    {
+        TBlockSize keepMask = 0;
+        for (TBlockSize flags = block->_occupiedFlags; remaining != 0; --remaining)
+        {
+            TBlockSize const position = static_cast<TBlockSize>(flags & static_cast<TBlockSize>(~(flags-1)));
+            keepMask |= position;
+            flags &=~ position;
+        }
+        this->g_dataSize -= destroyElements(block, static_cast<TBlockSize>(~keepMask));
+    }
+    this->spareBlocksAfter(block);
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TPredicate>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::removeElements(TPredicate&& predicate, Compactions compaction)
+{
+    std::size_t const oldSize = this->g_dataSize;
+    T const* previous = nullptr;
+
+    if (compaction == Compactions::NONE)
+    {
+        Block* block = this->g_startBlock;
+        while (block != nullptr)
+        {
+            Block* nextBlock = block->_nextBlock;
+            T* data = reinterpret_cast<T*>(&block->_data);
+
+            TBlockSize removeMask = 0;
+            for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+            {
+                auto const index = lowestIndex(flags);
+                if (predicate(previous, data[index]))
+                {
+                    removeMask |= static_cast<TBlockSize>(gPositionFirst << index);
+                }
+                else
+                {
+                    previous = data + index;
+                }
+            }
+
+            if (removeMask != 0)
+            {
+                this->g_dataSize -= destroyElements(block, removeMask);
+                if (block->_occupiedFlags == 0)
+                {
+                    this->unlinkBlock(block);
+                }
+            }
+            block = nextBlock;
+        }
+
+        this->refreshCacheFrontIndex();
+        this->refreshCacheBackIndex();
+        return oldSize - this->g_dataSize;
+    }
+
+    //The write cursor can never pass the read cursor, so every place between them is free
+    Block* writeBlock = this->g_startBlock;
+    BlockIndex writeIndex = 0;
+    for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        T* data = reinterpret_cast<T*>(&block->_data);
+
+        for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+        {
+            auto const index = lowestIndex(flags);
+            auto const position = static_cast<TBlockSize>(gPositionFirst << index);
+
+            if (predicate(previous, data[index]))
+            {
+                data[index].~T();
+                block->_occupiedFlags &=~ position;
+                --this->g_dataSize;
+                continue;
+            }
+
+            T* destination = reinterpret_cast<T*>(&writeBlock->_data) + writeIndex;
+            if (destination != data + index)
+            {
+                moveElement(destination, data + index);
+                block->_occupiedFlags &=~ position;
+                writeBlock->_occupiedFlags |= static_cast<TBlockSize>(gPositionFirst << writeIndex);
+            }
+            previous = destination;
+
+            if (++writeIndex > gIndexLast)
+            {
+                writeBlock = writeBlock->_nextBlock;
+                writeIndex = 0;
+            }
+        }
+    }
+
+    this->freeBlocksAfterPacking(writeBlock, writeIndex);
+    return oldSize - this->g_dataSize;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::packRelocatable()
+{
+    //Same as the packing of removeElements but every run of consecutive elements is moved with one memmove
+    Block* writeBlock = this->g_startBlock;
+    BlockIndex writeIndex = 0;
+    for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        T* data = reinterpret_cast<T*>(&block->_data);
+        TBlockSize flags = block->_occupiedFlags;
+        block->_occupiedFlags = 0;
+
+        while (flags != 0)
+        {
+            auto const index = lowestIndex(flags);
+            auto const holes = static_cast<TBlockSize>(~static_cast<TBlockSize>(flags >> index));
+            auto count = holes == 0 ? static_cast<BlockIndex>(gIndexLast+1-index) : lowestIndex(holes);
+            count = std::min<BlockIndex>(count, gIndexLast+1-writeIndex);
+
+            T* destination = reinterpret_cast<T*>(&writeBlock->_data) + writeIndex;
+            if (destination != data + index)
+            {
+                std::memmove(static_cast<void*>(destination), static_cast<void const*>(data + index), sizeof(T)*count);
+            }
+            flags &=~ rangeMask(index, count);
+            writeBlock->_occupiedFlags |= rangeMask(writeIndex, count);
+
+            writeIndex += count;
+            if (writeIndex > gIndexLast)
+            {
+                writeBlock = writeBlock->_nextBlock;
+                writeIndex = 0;
+            }
+        }
+    }
+
+    this->freeBlocksAfterPacking(writeBlock, writeIndex);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::compactStep(std::size_t maxMoves, base_iterator* tracked)
+{
+    //Adjacent blocks that fit in one block are merged, a pair that can't be merged still cost one move
+    std::size_t moves = 0;
+    Block* block = this->g_compactCursor == nullptr ? this->g_startBlock : this->g_compactCursor;
+    while (moves < maxMoves)
+    {
+        Block* nextBlock = block->_nextBlock;
+        if (nextBlock == nullptr)
+        {//End of the chain, the next step will start from the beginning
+            block = nullptr;
+            break;
+        }
+
+        if (popCount(block->_occupiedFlags) + popCount(nextBlock->_occupiedFlags) > gIndexLast+1)
+        {
+            ++moves;
+            block = nextBlock;
+            continue;
+        }
+
+        auto const costFirst = mergeCost(block, nextBlock, true);
+        auto const costNext = mergeCost(block, nextBlock, false);
+        auto const cost = std::min(costFirst, costNext);
+        if (cost > maxMoves - moves)
+        {
+            if (moves != 0)
+            {//Not enough budget left, we will continue from here
+                break;
+            }
+            //This merge will never fit the budget
+            ++moves;
+            block = nextBlock;
+            continue;
+        }
+
+        block = this->mergeBlocks(block, nextBlock, costFirst <= costNext, tracked);
+        moves += cost;
+    }
+
+    this->g_compactCursor = block;
+    return moves;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::mergeCost(Block const* block, Block const* nextBlock, bool intoFirst)
+{
+    auto const flags = block->_occupiedFlags;
+    auto const nextFlags = nextBlock->_occupiedFlags;
+    auto const count = popCount(flags);
+    auto const nextCount = popCount(nextFlags);
+
+    if (intoFirst)
+    {//Elements of the next block are appended after the last element, the block is packed first if needed
+        if (highestIndex(flags) + 1 + nextCount <= gIndexLast+1)
+        {
+            return nextCount;
+        }
+        return nextCount + packCost<Directions::FRONT>(flags);
+    }
+
+    //Elements of the block are prepended before the first element of the next block
+    if (lowestIndex(nextFlags) >= count)
+    {
+        return count;
+    }
+    return count + packCost<Directions::BACK>(nextFlags);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::applyDensityFloor(Block* block, base_iterator* tracked)
+{
+    auto const count = popCount(block->_occupiedFlags);
+    if (static_cast<float>(count) >= this->g_densityFloor * static_cast<float>(gIndexLast+1))
+    {
+        return;
+    }
+
+    //The block is too sparse, merge it with the neighbour that is the cheapest to merge with
+    Block* first = nullptr;
+    bool intoFirst = true;
+    std::size_t bestCost = std::numeric_limits<std::size_t>::max();
+    auto const consider = [&](Block* left, Block* right){
+        if (popCount(left->_occupiedFlags) + popCount(right->_occupiedFlags) > gIndexLast+1)
+        {
+            return;
+        }
+        for (bool const direction : {true, false})
+        {
+            auto const cost = mergeCost(left, right, direction);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                first = left;
+                intoFirst = direction;
+            }
+        }
+    };
+
+    if (block->_lastBlock != nullptr)
+    {
+        consider(block->_lastBlock, block);
+    }
+    if (block->_nextBlock != nullptr)
+    {
+        consider(block, block->_nextBlock);
+    }
+
+    if (first != nullptr)
+    {
+        this->mergeBlocks(first, first->_nextBlock, intoFirst, tracked);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::mergeBlocks(Block* block, Block* nextBlock, bool intoFirst, base_iterator* tracked)
+{
+    Block* receiver = intoFirst ? block : nextBlock;
+    Block* donor = intoFirst ? nextBlock : block;
+
+    if (intoFirst)
+    {
+        if (highestIndex(block->_occupiedFlags) + 1 + popCount(nextBlock->_occupiedFlags) > gIndexLast+1)
+        {
+            packBlock<Directions::FRONT>(block, tracked);
+        }
+
+        auto index = static_cast<BlockIndex>(highestIndex(block->_occupiedFlags) + 1);
+        for (TBlockSize flags = nextBlock->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+        {
+            relocateElement(nextBlock, lowestIndex(flags), block, index++, tracked);
+        }
+    }
+    else
+    {
+        if (lowestIndex(nextBlock->_occupiedFlags) < popCount(block->_occupiedFlags))
+        {
+            packBlock<Directions::BACK>(nextBlock, tracked);
+        }
+
+        auto index = static_cast<BlockIndex>(lowestIndex(nextBlock->_occupiedFlags) - 1);
+        for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &=~ static_cast<TBlockSize>(gPositionFirst << highestIndex(flags)))
+        {
+            relocateElement(block, highestIndex(flags), nextBlock, index--, tracked);
+        }
+    }
+
+    this->unlinkBlock(donor);
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+
+    if (tracked != nullptr && tracked->_block == donor)
+    {//Only the end iterator can still point to the donor block
+        *tracked = this->end();
+    }
+    return receiver;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::relocateRange(Block* source, BlockIndex sourceIndex, Block* destination, BlockIndex destinationIndex, BlockIndex count)
+{
+    //count consecutive elements are relocated, the ranges can overlap inside the same block
+    if (count == 0)
+    {
+        return;
+    }
+
+    T* sourceData = reinterpret_cast<T*>(&source->_data) + sourceIndex;
+    T* destinationData = reinterpret_cast<T*>(&destination->_data) + destinationIndex;
+    if constexpr (gIsTriviallyRelocatable)
+    {
+        std::memmove(static_cast<void*>(destinationData), static_cast<void const*>(sourceData), sizeof(T)*count);
+    }
+    else if (source != destination || destinationIndex < sourceIndex)
+    {
+        for (BlockIndex i=0; i<count; ++i)
+        {
+            moveElement(destinationData+i, sourceData+i);
+        }
+    }
+    else
+    {
+        for (BlockIndex i=count; i!=0; --i)
+        {
+            moveElement(destinationData+i-1, sourceData+i-1);
+        }
+    }
+
+    source->_occupiedFlags &=~ rangeMask(sourceIndex, count);
+    destination->_occupiedFlags |= rangeMask(destinationIndex, count);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::relocateElement(Block* source, BlockIndex sourceIndex, Block* destination, BlockIndex destinationIndex, base_iterator* tracked)
+{
+    if (source == destination && sourceIndex == destinationIndex)
+    {
+        return;
+    }
+
+    T* sourceData = reinterpret_cast<T*>(&source->_data) + sourceIndex;
+    T* destinationData = reinterpret_cast<T*>(&destination->_data) + destinationIndex;
+    moveElement(destinationData, sourceData);
+    source->_occupiedFlags &=~ static_cast<TBlockSize>(gPositionFirst << sourceIndex);
+    destination->_occupiedFlags |= static_cast<TBlockSize>(gPositionFirst << destinationIndex);
+
+    if (tracked != nullptr && tracked->_dataLocation._data == sourceData)
+    {
+        tracked->_block = destination;
+        tracked->_dataLocation._data = destinationData;
+        tracked->_dataLocation._position = static_cast<TBlockSize>(gPositionFirst << destinationIndex);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::freeBlocksAfterPacking(Block* writeBlock, BlockIndex writeIndex)
+{
+    //Every block after the last written one is now empty
+    if (writeBlock == nullptr)
+    {
+        writeBlock = this->g_lastBlock;
+    }
+    else if (writeIndex == 0 && writeBlock != this->g_startBlock)
+    {
+        writeBlock = writeBlock->_lastBlock;
+    }
+    this->freeBlocksAfter(writeBlock);
+
+    this->refreshCacheFrontIndex();
+    this->refreshCacheBackIndex();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::DataLocation List<T, TBlockSize, TInsertPolicy>::requestFreePlace()
+{
+    if constexpr (TDirection == Directions::FRONT)
+    {
+        if (this->g_cacheFrontIndex > gIndexLast)
+        {//We have to allocate a new block as the index is out of range
+            this->allocateBlock<Directions::FRONT>();
+            this->g_cacheFrontIndex = gIndexLast;
+        }
+
+        DataLocation data{
+            reinterpret_cast<T*>(&this->g_startBlock->_data)+this->g_cacheFrontIndex,
+            static_cast<TBlockSize>(static_cast<TBlockSize>(1)<<this->g_cacheFrontIndex)
+        };
+
+        this->g_startBlock->_occupiedFlags |= data._position;
+        --this->g_cacheFrontIndex;
+
+        ++this->g_dataSize;
+
+        return data;
+    }
+    else
+    {
+        if (this->g_cacheBackIndex > gIndexLast)
+        {//We have to allocate a new block as the index is out of range
+            this->allocateBlock<Directions::BACK>();
+            this->g_cacheBackIndex = 0;
+        }
+
+        DataLocation data{
+            reinterpret_cast<T*>(&this->g_lastBlock->_data)+this->g_cacheBackIndex,
+            static_cast<TBlockSize>(static_cast<TBlockSize>(1)<<this->g_cacheBackIndex)
+        };
+
+        this->g_lastBlock->_occupiedFlags |= data._position;
+        ++this->g_cacheBackIndex;
+
+        ++this->g_dataSize;
+
+        return data;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr void List<T, TBlockSize, TInsertPolicy>::allocateBlock()
+{
+    if constexpr (TDirection == Directions::FRONT)
+    {
+        auto* oldBlock = this->g_startBlock;
+
+        this->g_startBlock = this->takeBlock();
+
+        this->g_startBlock->_nextBlock = oldBlock;
+        oldBlock->_lastBlock = this->g_startBlock;
+    }
+    else
+    {
+        auto* oldBlock = this->g_lastBlock;
+
+        this->g_lastBlock = this->takeBlock();
+
+        this->g_lastBlock->_lastBlock = oldBlock;
+        oldBlock->_nextBlock = this->g_lastBlock;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::allocateBlock()
+{
+    return new Block{};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::takeBlock()
+{
+    //Blocks kept by a shrink are used before allocating
+    Block* block = this->g_spareBlocks;
+    if (block == nullptr)
+    {
+        return allocateBlock();
+    }
+    this->g_spareBlocks = block->_nextBlock;
+    block->_nextBlock = nullptr;
+    return block;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::freePlaceBefore(Block* block, BlockIndex index)
+{
+    //Every way to free a place is priced in moved elements, an allocation is priced as a full block of moves
+    enum class Ways
+    {
+        HOLE_BEFORE,
+        HOLE_AFTER,
+        PREVIOUS_BLOCK,
+        NEXT_BLOCK,
+        NEW_PREVIOUS_BLOCK,
+        NEW_NEXT_BLOCK
+    };
+    constexpr std::size_t allocationCost = gIndexLast+1;
+
+    TBlockSize const flags = block->_occupiedFlags;
+    if constexpr (TInsertPolicy == InsertPolicies::SPLIT)
+    {
+        if (flags == std::numeric_limits<TBlockSize>::max())
+        {
+            return this->splitFullBlock(block, index);
+        }
+    }
+
+    auto const position = static_cast<TBlockSize>(gPositionFirst << index);
+    auto const freeBefore = static_cast<TBlockSize>(~flags & static_cast<TBlockSize>(position-1));
+    auto const freeAfter = static_cast<TBlockSize>(~flags & static_cast<TBlockSize>(~(position | static_cast<TBlockSize>(position-1))));
+    Block* previousBlock = block->_lastBlock;
+    Block* nextBlock = block->_nextBlock;
+
+    Ways way = Ways::NEW_PREVIOUS_BLOCK;
+    std::size_t cost = allocationCost + index;
+    auto const consider = [&](Ways candidate, std::size_t candidateCost){
+        if (candidateCost < cost)
+        {
+            way = candidate;
+            cost = candidateCost;
+        }
+    };
+
+    if constexpr (TInsertPolicy == InsertPolicies::SPLIT)
+    {//The block is not full, only its own holes are used
+        cost = std::numeric_limits<std::size_t>::max();
+        if (freeBefore != 0)
+        {
+            consider(Ways::HOLE_BEFORE, index - 1 - highestIndex(freeBefore));
+        }
+        if (freeAfter != 0)
+        {
+            consider(Ways::HOLE_AFTER, lowestIndex(freeAfter) - index);
+        }
+    }
+    else
+    {
+        consider(Ways::NEW_NEXT_BLOCK, allocationCost + gIndexLast+1 - index);
+        if (freeBefore != 0)
+        {
+            consider(Ways::HOLE_BEFORE, index - 1 - highestIndex(freeBefore));
+        }
+        else if (previousBlock != nullptr && previousBlock->_occupiedFlags != std::numeric_limits<TBlockSize>::max())
+        {
+            bool const topFree = (previousBlock->_occupiedFlags & gPositionLast) == 0;
+            consider(Ways::PREVIOUS_BLOCK, index + (topFree ? 0 : packCost<Directions::FRONT>(previousBlock->_occupiedFlags)));
+        }
+        if (freeAfter != 0)
+        {
+            consider(Ways::HOLE_AFTER, lowestIndex(freeAfter) - index);
+        }
+        else if (nextBlock != nullptr && nextBlock->_occupiedFlags != std::numeric_limits<TBlockSize>::max())
+        {
+            bool const bottomFree = (nextBlock->_occupiedFlags & gPositionFirst) == 0;
+            consider(Ways::NEXT_BLOCK, gIndexLast+1 - index + (bottomFree ? 0 : packCost<Directions::BACK>(nextBlock->_occupiedFlags)));
+        }
+    }
+
+    switch (way)
+    {
+    case Ways::HOLE_BEFORE:
+    {
+        auto const hole = highestIndex(freeBefore);
+        shiftElements<Directions::FRONT>(block, static_cast<BlockIndex>(hole+1), static_cast<BlockIndex>(index-1-hole));
+        return iterator{block, DataLocation{reinterpret_cast<T*>(&block->_data) + index-1, static_cast<TBlockSize>(position>>1)}};
+    }
+    case Ways::HOLE_AFTER:
+        shiftElements<Directions::BACK>(block, index, static_cast<BlockIndex>(lowestIndex(freeAfter) - index));
+        return iterator{block, DataLocation{reinterpret_cast<T*>(&block->_data) + index, position}};
+    case Ways::PREVIOUS_BLOCK:
+    case Ways::NEW_PREVIOUS_BLOCK:
+    {
+        BlockIndex previousIndex = gIndexMid;
+        if (way == Ways::NEW_PREVIOUS_BLOCK)
+        {
+            previousBlock = this->insertNewBlock<Directions::FRONT>(block);
+        }
+        else
+        {
+            if ((previousBlock->_occupiedFlags & gPositionLast) != 0)
+            {
+                packBlock<Directions::FRONT>(previousBlock, nullptr);
+            }
+            previousIndex = static_cast<BlockIndex>(highestIndex(previousBlock->_occupiedFlags) + 1);
+        }
+
+        if (index == 0)
+        {//The new element is the last one of the previous block
+            return iterator{previousBlock, DataLocation{reinterpret_cast<T*>(&previousBlock->_data) + previousIndex,
+                                                         static_cast<TBlockSize>(gPositionFirst << previousIndex)}};
+        }
+
+        //The first element goes to the previous block, then the others are shifted
+        relocateElement(block, 0, previousBlock, previousIndex, nullptr);
+        shiftElements<Directions::FRONT>(block, 1, static_cast<BlockIndex>(index-1));
+        return iterator{block, DataLocation{reinterpret_cast<T*>(&block->_data) + index-1, static_cast<TBlockSize>(position>>1)}};
+    }
+    case Ways::NEXT_BLOCK:
+    case Ways::NEW_NEXT_BLOCK:
+    {
+        BlockIndex nextIndex = gIndexMid;
+        if (way == Ways::NEW_NEXT_BLOCK)
+        {
+            nextBlock = this->insertNewBlock<Directions::BACK>(block);
+        }
+        else
+        {
+            if ((nextBlock->_occupiedFlags & gPositionFirst) != 0)
+            {
+                packBlock<Directions::BACK>(nextBlock, nullptr);
+            }
+            nextIndex = static_cast<BlockIndex>(lowestIndex(nextBlock->_occupiedFlags) - 1);
+        }
+
+        //The last element goes to the next block, then the others are shifted
+        relocateElement(block, gIndexLast, nextBlock, nextIndex, nullptr);
+        shiftElements<Directions::BACK>(block, index, static_cast<BlockIndex>(gIndexLast - index));
+        return iterator{block, DataLocation{reinterpret_cast<T*>(&block->_data) + index, position}};
+    }
+    }
+    return this->end();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::splitFullBlock(Block* block, BlockIndex index)
+{
+    //The upper half goes to a new next block at the same indexes,
+    //then the half holding the position is spread so the free half is right before the position
+    Block* nextBlock = this->insertNewBlock<Directions::BACK>(block);
+    relocateRange(block, gIndexMid, nextBlock, gIndexMid, gIndexMid);
+
+    if (index < gIndexMid)
+    {
+        relocateRange(block, index, block, static_cast<BlockIndex>(index+gIndexMid), static_cast<BlockIndex>(gIndexMid-index));
+        BlockIndex const freeIndex = index+gIndexMid-1;
+        return iterator{block, DataLocation{reinterpret_cast<T*>(&block->_data) + freeIndex, static_cast<TBlockSize>(gPositionFirst << freeIndex)}};
+    }
+
+    relocateRange(nextBlock, gIndexMid, nextBlock, 0, static_cast<BlockIndex>(index-gIndexMid));
+    BlockIndex const freeIndex = index-1;
+    return iterator{nextBlock, DataLocation{reinterpret_cast<T*>(&nextBlock->_data) + freeIndex, static_cast<TBlockSize>(gPositionFirst << freeIndex)}};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr void List<T, TBlockSize, TInsertPolicy>::shiftElements(Block* block, BlockIndex first, BlockIndex count)
+{
+    //Move count elements starting at first by one place toward the front or the back of the block
+    if constexpr (TDirection == Directions::FRONT)
+    {
+        relocateRange(block, first, block, static_cast<BlockIndex>(first-1), count);
+    }
+    else
+    {
+        relocateRange(block, first, block, static_cast<BlockIndex>(first+1), count);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr void List<T, TBlockSize, TInsertPolicy>::packBlock(Block* block, base_iterator* tracked)
+{
+    //Elements are packed against the first place (FRONT) or the last place (BACK) of the block
+    if constexpr (TDirection == Directions::FRONT)
+    {
+        BlockIndex rank = 0;
+        for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1), ++rank)
+        {
+            relocateElement(block, lowestIndex(flags), block, rank, tracked);
+        }
+    }
+    else
+    {
+        BlockIndex rank = gIndexLast;
+        for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &=~ static_cast<TBlockSize>(gPositionFirst << highestIndex(flags)), --rank)
+        {
+            relocateElement(block, highestIndex(flags), block, rank, tracked);
+        }
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::packCost(TBlockSize flags)
+{
+    //Elements already packed don't move
+    auto const packed = TDirection == Directions::FRONT ? flags : reverseBits(flags);
+    return popCount(flags) - popCount(static_cast<TBlockSize>(packed & static_cast<TBlockSize>(~packed-1)));
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<typename List<T, TBlockSize, TInsertPolicy>::Directions TDirection>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::insertNewBlock(Block* block)
+{
+    if constexpr (TDirection == Directions::FRONT)
+    {
+        auto* oldBlock = block->_lastBlock;
+
+        block->_lastBlock = this->takeBlock();
+
+        block->_lastBlock->_nextBlock = block;
+        block->_lastBlock->_lastBlock = oldBlock;
+
+        if (oldBlock == nullptr)
+        {
+            this->g_startBlock = block->_lastBlock;
+        }
+        else
+        {
+            oldBlock->_nextBlock = block->_lastBlock;
+        }
+
+        return block->_lastBlock;
+    }
+    else
+    {
+        auto* oldBlock = block->_nextBlock;
+
+        block->_nextBlock = this->takeBlock();
+
+        block->_nextBlock->_nextBlock = oldBlock;
+        block->_nextBlock->_lastBlock = block;
+
+        if (oldBlock == nullptr)
+        {
+            this->g_lastBlock = block->_nextBlock;
+        }
+        else
+        {
+            oldBlock->_lastBlock = block->_nextBlock;
+        }
+
+        return block->_nextBlock;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::splitBlock(Block* block, TBlockSize position)
+{
+    //Every element from the position is moved to a new next block at the same index,
+    //so the cache indexes stay valid
+    Block* newBlock = this->insertNewBlock<Directions::BACK>(block);
+    TBlockSize const movedFlags = block->_occupiedFlags & static_cast<TBlockSize>(~(position-1));
+
+    T* source = reinterpret_cast<T*>(&block->_data);
+    T* destination = reinterpret_cast<T*>(&newBlock->_data);
+    if constexpr (gIsTriviallyRelocatable)
+    {
+        if (movedFlags != 0)
+        {
+            auto const first = lowestIndex(movedFlags);
+            std::memcpy(static_cast<void*>(destination+first), static_cast<void const*>(source+first), sizeof(T)*(gIndexLast+1-first));
+        }
+    }
+    else
+    {
+        for (TBlockSize flags = movedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+        {
+            auto const index = lowestIndex(flags);
+            moveElement(destination+index, source+index);
+        }
+    }
+
+    block->_occupiedFlags &=~ movedFlags;
+    newBlock->_occupiedFlags = movedFlags;
+    return newBlock;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Block* List<T, TBlockSize, TInsertPolicy>::splitBefore(const_iterator const& pos)
+{
+    if (pos._dataLocation._position == 0)
+    {//This is the end, nothing to split
+        return nullptr;
+    }
+
+    if ((pos._block->_occupiedFlags & (pos._dataLocation._position-1)) == 0)
+    {//Already the first element of the block
+        return pos._block;
+    }
+
+    return this->splitBlock(pos._block, pos._dataLocation._position);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::linkChain(Block* before, Block* first, Block* last, std::size_t count)
+{
+    first->_lastBlock = nullptr;
+    last->_nextBlock = nullptr;
+
+    if (this->g_dataSize == 0)
+    {//Our only block is empty, the chain simply replace it
+        delete this->g_startBlock;
+
+        this->g_startBlock = first;
+        this->g_lastBlock = last;
+        this->g_dataSize = count;
+
+        this->refreshCacheFrontIndex();
+        this->refreshCacheBackIndex();
+        return;
+    }
+
+    if (before == nullptr)
+    {//Link at the end
+        first->_lastBlock = this->g_lastBlock;
+        this->g_lastBlock->_nextBlock = first;
+        this->g_lastBlock = last;
+
+        this->refreshCacheBackIndex();
+    }
+    else
+    {
+        first->_lastBlock = before->_lastBlock;
+        last->_nextBlock = before;
+
+        if (before->_lastBlock == nullptr)
         {
-            oldBlock->_nextBlock = block->_lastBlock;
+            this->g_startBlock = first;
+            this->refreshCacheFrontIndex();
+        }
+        else
+        {
+            before->_lastBlock->_nextBlock = first;
         }
+        before->_lastBlock = last;
+    }
 
-        return block->_lastBlock;
+    this->g_dataSize += count;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr std::size_t List<T, TBlockSize, TInsertPolicy>::unlinkChain(Block* first, Block* last)
+{
+    std::size_t count = 0;
+    for (Block* block = first; block != last->_nextBlock; block = block->_nextBlock)
+    {
+        count += popCount(block->_occupiedFlags);
+    }
+    this->g_compactCursor = nullptr;
+
+    Block* previous = first->_lastBlock;
+    Block* next = last->_nextBlock;
+
+    if (previous == nullptr && next == nullptr)
+    {//The whole chain is taken, we need a new empty block
+        this->g_startBlock = this->allocateBlock();
+        this->g_lastBlock = this->g_startBlock;
+
+        this->g_cacheFrontIndex = gIndexMid-1;
+        this->g_cacheBackIndex = gIndexMid;
     }
     else
     {
-        auto* oldBlock = block->_nextBlock;
+        if (previous == nullptr)
+        {
+            next->_lastBlock = nullptr;
+            this->g_startBlock = next;
+            this->refreshCacheFrontIndex();
+        }
+        else
+        {
+            previous->_nextBlock = next;
+        }
+
+        if (next == nullptr)
+        {
+            previous->_nextBlock = nullptr;
+            this->g_lastBlock = previous;
+            this->refreshCacheBackIndex();
+        }
+        else
+        {
+            next->_lastBlock = previous;
+        }
+    }
 
-        block->_nextBlock = this->allocateBlock();
+    first->_lastBlock = nullptr;
+    last->_nextBlock = nullptr;
 
-        block->_nextBlock->_nextBlock = oldBlock;
-        block->_nextBlock->_lastBlock = block;
+    this->g_dataSize -= count;
+    return count;
+}
 
-        if (oldBlock == nullptr)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr bool List<T, TBlockSize, TInsertPolicy>::unlinkBlock(Block* block)
+{
+    auto* nextBlock = block->_nextBlock;
+    auto* lastBlock = block->_lastBlock;
+
+    if (nextBlock == nullptr && lastBlock == nullptr)
+    {//We can't free the last block
+        this->g_cacheBackIndex = gIndexMid;
+        this->g_cacheFrontIndex = gIndexMid-1;
+        return false;
+    }
+
+    if (nextBlock != nullptr && lastBlock != nullptr)
+    {//This block can't be a start or end block
+        nextBlock->_lastBlock = lastBlock;
+        lastBlock->_nextBlock = nextBlock;
+    }
+    else if (lastBlock == nullptr)
+    {
+        nextBlock->_lastBlock = nullptr;
+        this->g_startBlock = nextBlock;
+        this->refreshCacheFrontIndex();
+    }
+    else
+    {
+        lastBlock->_nextBlock = nullptr;
+        this->g_lastBlock = lastBlock;
+        this->refreshCacheBackIndex();
+    }
+
+    if (block == this->g_compactCursor)
+    {
+        this->g_compactCursor = nullptr;
+    }
+    delete block;
+    return true;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TCompare>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::Chain List<T, TBlockSize, TInsertPolicy>::mergeChains(Block* left, Block* right, TCompare& compare, Block*& spareBlocks)
+{
+    //Both chains are consumed element by element and written packed into a new chain,
+    //drained blocks are recycled right away for the output so only a couple of blocks are allocated
+    ChainWriter writer{spareBlocks};
+
+    TBlockSize leftFlags = left->_occupiedFlags;
+    TBlockSize rightFlags = right->_occupiedFlags;
+
+    auto const advance = [&spareBlocks](Block*& block, TBlockSize& flags){
+        flags &= static_cast<TBlockSize>(flags-1);
+        if (flags == 0)
         {
-            this->g_lastBlock = block->_nextBlock;
+            Block* drained = block;
+            block = block->_nextBlock;
+            flags = block == nullptr ? 0 : block->_occupiedFlags;
+            recycleBlock(drained, spareBlocks);
+        }
+    };
+
+    while (left != nullptr && right != nullptr)
+    {
+        T* leftData = reinterpret_cast<T*>(&left->_data) + lowestIndex(leftFlags);
+        T* rightData = reinterpret_cast<T*>(&right->_data) + lowestIndex(rightFlags);
+
+        if (compare(*rightData, *leftData))
+        {
+            writer.write(rightData);
+            advance(right, rightFlags);
         }
         else
         {
-            oldBlock->_lastBlock = block->_nextBlock;
+            writer.write(leftData);
+            advance(left, leftFlags);
         }
-
-        return block->_nextBlock;
     }
+    for (; left != nullptr; advance(left, leftFlags))
+    {
+        writer.write(reinterpret_cast<T*>(&left->_data) + lowestIndex(leftFlags));
+    }
+    for (; right != nullptr; advance(right, rightFlags))
+    {
+        writer.write(reinterpret_cast<T*>(&right->_data) + lowestIndex(rightFlags));
+    }
+
+    return writer._chain;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::adoptChain(Chain const& chain)
+{
+    chain._first->_lastBlock = nullptr;
+    chain._last->_nextBlock = nullptr;
+    this->g_startBlock = chain._first;
+    this->g_lastBlock = chain._last;
+    this->g_compactCursor = nullptr;
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::BlockIndex List<T, TBlockSize>::shiftBlockToFreeUpSpace(Block* block)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::radixSort()
 {
-    TBlockSize emptyPlacePosition = gPositionFirst;
-    BlockIndex emptyIndex = 0;
+    constexpr std::size_t digitCount = sizeof(T);
 
-    TBlockSize dataPlacePosition = emptyPlacePosition;
-    T* data = reinterpret_cast<T*>(&block->_data);
-    do
+    //One pass to build the histogram of every digit
+    std::vector<std::size_t> histogram(digitCount*256, 0);
+    for (Block* block = this->g_startBlock; block != nullptr; block = block->_nextBlock)
     {
-        if (!(block->_occupiedFlags & emptyPlacePosition))
+        T const* data = reinterpret_cast<T const*>(&block->_data);
+        for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
         {
-            //Find the first data to move
-            do
+            auto const key = radixKey(data[lowestIndex(flags)]);
+            for (std::size_t digit=0; digit<digitCount; ++digit)
+            {
+                ++histogram[digit*256 + ((key >> (digit*8)) & 0xFF)];
+            }
+        }
+    }
+
+    //Every pass streams the chain into one chain per bucket, drained blocks are recycled for the buckets and
+    //the spare ones are kept for the next passes, so the extra memory is at most one partially filled block per bucket (256 blocks)
+    Block* spareBlocks = nullptr;
+    std::vector<ChainWriter> buckets;
+    buckets.reserve(256);
+    for (std::size_t digit=0; digit<digitCount; ++digit)
+    {
+        auto const* counts = histogram.data() + digit*256;
+        if (*std::max_element(counts, counts+256) == this->g_dataSize)
+        {//Every element has the same digit, nothing to do
+            continue;
+        }
+
+        buckets.clear();
+        for (std::size_t i=0; i<256; ++i)
+        {
+            buckets.push_back(ChainWriter{spareBlocks});
+        }
+
+        Block* block = this->g_startBlock;
+        while (block != nullptr)
+        {
+            T* data = reinterpret_cast<T*>(&block->_data);
+            for (TBlockSize flags = block->_occupiedFlags; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+            {
+                auto const index = lowestIndex(flags);
+                buckets[(radixKey(data[index]) >> (digit*8)) & 0xFF].write(data + index);
+            }
+
+            Block* nextBlock = block->_nextBlock;
+            recycleBlock(block, spareBlocks);
+            block = nextBlock;
+        }
+
+        Chain result{};
+        for (auto const& bucket : buckets)
+        {
+            if (bucket._chain._first == nullptr)
             {
-                dataPlacePosition <<= 1;
-                ++data;
+                continue;
             }
-            while ((block->_occupiedFlags & dataPlacePosition) == 0);
 
-            //Move the data
-            new (reinterpret_cast<T*>(&block->_data) + emptyIndex) T(std::move(*data));
-            block->_occupiedFlags |= emptyPlacePosition;
-            block->_occupiedFlags &=~ dataPlacePosition;
-            data->~T();
+            if (result._first == nullptr)
+            {
+                result = bucket._chain;
+            }
+            else
+            {
+                result._last->_nextBlock = bucket._chain._first;
+                bucket._chain._first->_lastBlock = result._last;
+                result._last = bucket._chain._last;
+            }
         }
+        this->adoptChain(result);
+    }
+    freeSpareBlocks(spareBlocks);
+
+    //Buckets are leaving partially filled blocks behind
+    this->compact();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+auto List<T, TBlockSize, TInsertPolicy>::radixKey(T const& value)
+{
+    //Map the value to an unsigned key with the same ordering
+    using Key = std::conditional_t<sizeof(T) == 1, uint8_t,
+                std::conditional_t<sizeof(T) == 2, uint16_t,
+                std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t> > >;
+    constexpr Key signBit = static_cast<Key>(static_cast<Key>(1) << (sizeof(T)*8 - 1));
 
-        emptyPlacePosition <<= 1;
-        ++emptyIndex;
+    Key key{};
+    std::memcpy(&key, &value, sizeof(T));
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<Key>((key & signBit) ? ~key : (key | signBit));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<Key>(key ^ signBit);
+    }
+    else
+    {
+        return key;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::recycleBlock(Block* block, Block*& spareBlocks)
+{
+    block->_occupiedFlags = 0;
+    block->_lastBlock = nullptr;
+    block->_nextBlock = spareBlocks;
+    spareBlocks = block;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::freeSpareBlocks(Block*& spareBlocks)
+{
+    while (spareBlocks != nullptr)
+    {
+        Block* next = spareBlocks->_nextBlock;
+        delete spareBlocks;
+        spareBlocks = next;
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::freeBlocksAfter(Block* block)
+{
+    Block* nextBlock = block->_nextBlock;
+    while (nextBlock != nullptr)
+    {
+        Block* next = nextBlock->_nextBlock;
+        this->freeBlock(nextBlock);
+        nextBlock = next;
+    }
 
-        dataPlacePosition = emptyPlacePosition;
-        data = reinterpret_cast<T*>(&block->_data) + emptyIndex;
+    block->_nextBlock = nullptr;
+    this->g_lastBlock = block;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::spareBlocksAfter(Block* block)
+{
+    Block* nextBlock = block->_nextBlock;
+    while (nextBlock != nullptr)
+    {
+        Block* next = nextBlock->_nextBlock;
+        this->g_dataSize -= destroyElements(nextBlock, std::numeric_limits<TBlockSize>::max());
+        if (nextBlock == this->g_compactCursor)
+        {
+            this->g_compactCursor = nullptr;
+        }
+        recycleBlock(nextBlock, this->g_spareBlocks);
+        nextBlock = next;
     }
-    while ((block->_occupiedFlags & ~(emptyPlacePosition-1)) != 0); //Until the block is fully shifted to the "right"
 
-    return emptyIndex;
+    block->_nextBlock = nullptr;
+    this->g_lastBlock = block;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::refreshCacheFrontIndex()
+{
+    //The front index is the free place just before the first element of the start block
+    auto const flags = this->g_startBlock->_occupiedFlags;
+    this->g_cacheFrontIndex = flags == 0 ? gIndexMid-1 : static_cast<BlockIndex>(lowestIndex(flags)-1);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::refreshCacheBackIndex()
+{
+    //The back index is the free place just after the last element of the last block
+    auto const flags = this->g_lastBlock->_occupiedFlags;
+    this->g_cacheBackIndex = flags == 0 ? gIndexMid : static_cast<BlockIndex>(highestIndex(flags)+1);
 }
 
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::freeBlock(Block* block)
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::moveElement(T* destination, T* source)
+{
+    if constexpr (gIsTriviallyRelocatable)
+    {
+        std::memcpy(static_cast<void*>(destination), static_cast<void const*>(source), sizeof(T));
+    }
+    else
+    {
+        new (destination) T(std::move(*source));
+        source->~T();
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::mirrorBlock(Block* block)
 {
     T* data = reinterpret_cast<T*>(&block->_data);
-    for (TBlockSize iPos=gPositionFirst; iPos!=0; iPos<<=1)
+
+    if constexpr (gIsTriviallyRelocatable)
+    {//Free places are swapped too, this is cheaper than checking the flags
+        uint8_t buffer[sizeof(T)];
+        for (BlockIndex i=0; i<gIndexMid; ++i)
+        {
+            std::memcpy(buffer, static_cast<void const*>(data+i), sizeof(T));
+            std::memcpy(static_cast<void*>(data+i), static_cast<void const*>(data+gIndexLast-i), sizeof(T));
+            std::memcpy(static_cast<void*>(data+gIndexLast-i), buffer, sizeof(T));
+        }
+    }
+    else
+    {
+        TBlockSize const flags = block->_occupiedFlags;
+        for (BlockIndex i=0; i<gIndexMid; ++i)
+        {
+            bool const lowOccupied = (flags & (gPositionFirst << i)) != 0;
+            bool const highOccupied = (flags & (gPositionLast >> i)) != 0;
+
+            if (lowOccupied && highOccupied)
+            {//Swapped through a temporary place, so only move construction is needed as for the other operations
+                alignas(T) uint8_t buffer[sizeof(T)];
+                T* temporary = reinterpret_cast<T*>(buffer);
+                moveElement(temporary, data+i);
+                moveElement(data+i, data+gIndexLast-i);
+                moveElement(data+gIndexLast-i, temporary);
+            }
+            else if (lowOccupied)
+            {
+                moveElement(data+gIndexLast-i, data+i);
+            }
+            else if (highOccupied)
+            {
+                moveElement(data+i, data+gIndexLast-i);
+            }
+        }
+    }
+
+    block->_occupiedFlags = reverseBits(block->_occupiedFlags);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::BlockIndex List<T, TBlockSize, TInsertPolicy>::destroyElements(Block* block, TBlockSize mask)
+{
+    TBlockSize const flags = block->_occupiedFlags & mask;
+
+    if constexpr (!std::is_trivially_destructible_v<T>)
     {
-        if (block->_occupiedFlags & iPos)
+        T* data = reinterpret_cast<T*>(&block->_data);
+        for (TBlockSize remaining = flags; remaining != 0; remaining &= static_cast<TBlockSize>(remaining-1))
         {
-            data->~T();
-            --this->g_dataSize;
+            (data + lowestIndex(remaining))->~T();
         }
-        ++data;
+    }
+
+    block->_occupiedFlags &=~ flags;
+    return popCount(flags);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::BlockIndex List<T, TBlockSize, TInsertPolicy>::lowestIndex(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(__builtin_ctzll(flags));
+#else
+    BlockIndex index = 0;
+    while ((flags & gPositionFirst) == 0)
+    {
+        flags >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::BlockIndex List<T, TBlockSize, TInsertPolicy>::highestIndex(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(63 - __builtin_clzll(flags));
+#else
+    BlockIndex index = gIndexLast;
+    while ((flags & gPositionLast) == 0)
+    {
+        flags <<= 1;
+        --index;
+    }
+    return index;
+#endif
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::BlockIndex List<T, TBlockSize, TInsertPolicy>::popCount(TBlockSize flags)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<BlockIndex>(__builtin_popcountll(flags));
+#else
+    BlockIndex count = 0;
+    for (; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr TBlockSize List<T, TBlockSize, TInsertPolicy>::reverseBits(TBlockSize flags)
+{
+    TBlockSize result = 0;
+    for (; flags != 0; flags &= static_cast<TBlockSize>(flags-1))
+    {
+        result |= static_cast<TBlockSize>(gPositionLast >> lowestIndex(flags));
+    }
+    return result;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr TBlockSize List<T, TBlockSize, TInsertPolicy>::rangeMask(BlockIndex index, BlockIndex count)
+{
+    //count consecutive positions starting at index
+    if (count > gIndexLast)
+    {
+        return static_cast<TBlockSize>(~static_cast<TBlockSize>(0));
+    }
+    return static_cast<TBlockSize>(((static_cast<TBlockSize>(1) << count) - 1) << index);
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::freeBlock(Block* block)
+{
+    //Only set bits are visited, nothing at all for trivially destructible types
+    this->g_dataSize -= destroyElements(block, std::numeric_limits<TBlockSize>::max());
+    if (block == this->g_compactCursor)
+    {
+        this->g_compactCursor = nullptr;
     }
     delete block;
 }
 
+//ChainWriter
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::ChainWriter::write(T* data)
+{
+    if (this->_index > gIndexLast)
+    {//We need a new block, drained blocks are used first
+        Block* block = this->_spareBlocks;
+        if (block == nullptr)
+        {
+            block = allocateBlock();
+        }
+        else
+        {
+            this->_spareBlocks = block->_nextBlock;
+            block->_nextBlock = nullptr;
+        }
+
+        block->_lastBlock = this->_chain._last;
+        if (this->_chain._last == nullptr)
+        {
+            this->_chain._first = block;
+        }
+        else
+        {
+            this->_chain._last->_nextBlock = block;
+        }
+        this->_chain._last = block;
+        this->_index = 0;
+    }
+
+    moveElement(reinterpret_cast<T*>(&this->_chain._last->_data) + this->_index, data);
+    this->_chain._last->_occupiedFlags |= static_cast<TBlockSize>(gPositionFirst << this->_index);
+    ++this->_index;
+}
+
 //base_iterator
 
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::base_iterator::base_iterator(Block* block, DataLocation const& dataLocation) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::base_iterator::base_iterator(Block* block, DataLocation const& dataLocation) :
         _block(block),
         _dataLocation(dataLocation)
 {}
-template<class T, class TBlockSize>
-constexpr List<T, TBlockSize>::base_iterator::base_iterator(Block* block) :
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::base_iterator::base_iterator(Block* block) :
         _block(block)
 {}
 
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::base_iterator::operator--()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::base_iterator::operator--()
 {
     if (this->_dataLocation._position == 0)
     {
@@ -766,8 +2667,8 @@ constexpr void List<T, TBlockSize>::base_iterator::operator--()
     }
     while (!(this->_block->_occupiedFlags & this->_dataLocation._position));
 }
-template<class T, class TBlockSize>
-constexpr void List<T, TBlockSize>::base_iterator::operator++()
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::base_iterator::operator++()
 {
     if (this->_dataLocation._position == 0)
     {//Can't go further (end)
@@ -797,39 +2698,176 @@ constexpr void List<T, TBlockSize>::base_iterator::operator++()
     while (!(this->_block->_occupiedFlags & this->_dataLocation._position));
 }
 
-template<class T, class TBlockSize>
-constexpr bool List<T, TBlockSize>::base_iterator::operator==(const base_iterator& r) const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr bool List<T, TBlockSize, TInsertPolicy>::base_iterator::operator==(const base_iterator& r) const
 {
     return this->_block == r._block && this->_dataLocation._position == r._dataLocation._position;
 }
-template<class T, class TBlockSize>
-constexpr bool List<T, TBlockSize>::base_iterator::operator!=(const base_iterator& r) const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr bool List<T, TBlockSize, TInsertPolicy>::base_iterator::operator!=(const base_iterator& r) const
 {
     return !this->operator==(r);
 }
 
 //iterator
 
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::base_iterator::reference List<T, TBlockSize>::iterator::operator*() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::base_iterator::reference List<T, TBlockSize, TInsertPolicy>::iterator::operator*() const
 {
     return *this->_dataLocation._data;
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::base_iterator::pointer List<T, TBlockSize>::iterator::operator->() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::base_iterator::pointer List<T, TBlockSize, TInsertPolicy>::iterator::operator->() const
 {
     return this->_dataLocation._data;
 }
 
 //const_iterator
 
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::base_iterator::const_reference List<T, TBlockSize>::const_iterator::operator*() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::base_iterator::const_reference List<T, TBlockSize, TInsertPolicy>::const_iterator::operator*() const
 {
     return *this->_dataLocation._data;
 }
-template<class T, class TBlockSize>
-constexpr typename List<T, TBlockSize>::base_iterator::const_pointer List<T, TBlockSize>::const_iterator::operator->() const
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::base_iterator::const_pointer List<T, TBlockSize, TInsertPolicy>::const_iterator::operator->() const
 {
     return this->_dataLocation._data;
-}
\ No newline at end of file
+}
+
+//insert_cursor
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::insert_cursor::insert_cursor(List* list, const_iterator const& pos) :
+        _list(list),
+        _pos(pos)
+{}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr List<T, TBlockSize, TInsertPolicy>::insert_cursor::insert_cursor(insert_cursor&& r) noexcept :
+        _list(r._list),
+        _pos(r._pos),
+        _gapBlock(r._gapBlock),
+        _gapIndex(r._gapIndex)
+{
+    r._list = nullptr;
+    r._gapBlock = nullptr;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+List<T, TBlockSize, TInsertPolicy>::insert_cursor::~insert_cursor()
+{
+    this->release();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class U>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::insert_cursor::insert(U&& value)
+{
+    if (this->_pos._dataLocation._position == 0)
+    {//The cursor is at the end, this is a push back
+        return this->_list->insert(this->_list->end(), std::forward<U>(value));
+    }
+
+    if (this->_gapBlock == nullptr || this->_gapIndex > gIndexLast ||
+        (this->_gapBlock == this->_pos._block && this->_gapIndex == lowestIndex(this->_pos._dataLocation._position)))
+    {//The gap is used up
+        this->reserveGap();
+    }
+
+    Block* block = this->_gapBlock;
+    BlockIndex const index = this->_gapIndex++;
+    DataLocation const location{reinterpret_cast<T*>(&block->_data) + index, static_cast<TBlockSize>(gPositionFirst << index)};
+    new (location._data) T(std::forward<U>(value));
+    block->_occupiedFlags |= location._position;
+    ++this->_list->g_dataSize;
+
+    this->_list->refreshCacheFrontIndex();
+    this->_list->refreshCacheBackIndex();
+    return iterator{block, location};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr typename List<T, TBlockSize, TInsertPolicy>::iterator List<T, TBlockSize, TInsertPolicy>::insert_cursor::position() const
+{
+    if (this->_pos._dataLocation._position == 0)
+    {
+        return this->_list->end();
+    }
+    return iterator{this->_pos._block, this->_pos._dataLocation};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::insert_cursor::release()
+{
+    if (this->_gapBlock == nullptr)
+    {
+        return;
+    }
+
+    //The gap is given back, the block holding it is merged with its neighbour on the cursor side when both fit in one block.
+    //A gap made of free places before the cursor in its own block was not reserved, nothing is merged then
+    Block* block = this->_gapBlock;
+    this->_gapBlock = nullptr;
+
+    if (block == this->_pos._block || block->_nextBlock == nullptr ||
+        popCount(block->_occupiedFlags) + popCount(block->_nextBlock->_occupiedFlags) > gIndexLast+1)
+    {
+        return;
+    }
+
+    auto const costFirst = mergeCost(block, block->_nextBlock, true);
+    auto const costNext = mergeCost(block, block->_nextBlock, false);
+    this->_list->mergeBlocks(block, block->_nextBlock, costFirst <= costNext, &this->_pos);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+constexpr void List<T, TBlockSize, TInsertPolicy>::insert_cursor::reserveGap()
+{
+    if (this->_gapBlock != nullptr && this->_gapBlock != this->_pos._block)
+    {//The reserved block is full, a new one is reserved right after it
+        this->_gapBlock = this->_list->template insertNewBlock<Directions::BACK>(this->_gapBlock);
+        this->_gapIndex = 0;
+        return;
+    }
+
+    //The gap starts right after the element preceding the cursor
+    Block* block = this->_pos._block;
+    TBlockSize const position = this->_pos._dataLocation._position;
+    BlockIndex const index = lowestIndex(position);
+
+    auto const before = static_cast<TBlockSize>(block->_occupiedFlags & static_cast<TBlockSize>(position-1));
+    BlockIndex const start = before == 0 ? 0 : static_cast<BlockIndex>(highestIndex(before)+1);
+    if (start < index)
+    {//Free places are already before the cursor in its block
+        this->_gapBlock = block;
+        this->_gapIndex = start;
+        return;
+    }
+
+    if (index == 0)
+    {
+        Block* previousBlock = block->_lastBlock;
+        if (previousBlock != nullptr && (previousBlock->_occupiedFlags & gPositionLast) == 0)
+        {//The free tail of the previous block
+            this->_gapBlock = previousBlock;
+            this->_gapIndex = static_cast<BlockIndex>(highestIndex(previousBlock->_occupiedFlags)+1);
+            return;
+        }
+
+        //A whole block is reserved, it is filled right after so the chain never keeps an empty block
+        this->_gapBlock = this->_list->template insertNewBlock<Directions::FRONT>(block);
+        this->_gapIndex = 0;
+        return;
+    }
+
+    //Elements from the cursor are moved to a new next block at the same indexes, the tail of this block becomes the gap
+    Block* newBlock = this->_list->splitBlock(block, position);
+    this->_pos._block = newBlock;
+    this->_pos._dataLocation._data = reinterpret_cast<T*>(&newBlock->_data) + index;
+    this->_gapBlock = block;
+    this->_gapIndex = index;
+}
+
+//free functions
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy, class TPredicate>
+constexpr std::size_t erase_if(List<T, TBlockSize, TInsertPolicy>& list, TPredicate predicate)
+{
+    return list.remove_if(std::move(predicate));
+}
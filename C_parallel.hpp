@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "C_list.hpp"
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+namespace gg::par
+{
+
+//Small work stealing pool, the thread calling run() works too.
+//Every thread owns a range of task indices, it takes tasks from the front of its range
+//and when it is empty, it steals the back half of the range of an other thread.
+class ThreadPool
+{
+public:
+    //threadCount counts the calling thread, so threadCount-1 threads are started
+    explicit ThreadPool(std::size_t threadCount=std::max(1u, std::thread::hardware_concurrency()));
+    ThreadPool(ThreadPool const& r) = delete;
+    ThreadPool(ThreadPool&& r) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(ThreadPool const& r) = delete;
+    ThreadPool& operator=(ThreadPool&& r) = delete;
+
+    [[nodiscard]] std::size_t thread_count() const noexcept;
+
+    //Call task(i) for every i in [0, count) and return once they are all done, the first exception thrown is rethrown.
+    //Only one run() is done at a time, a task must not call run() on the same pool.
+    void run(std::size_t count, std::function<void(std::size_t)> const& task);
+
+private:
+    struct alignas(64) TaskRange
+    {
+        std::atomic<uint64_t> _range{0}; //Begin in the low half, end in the high half
+    };
+
+    void workerLoop(std::size_t worker);
+    void work(std::size_t worker);
+    [[nodiscard]] bool popTask(std::size_t worker, std::size_t& task);
+    [[nodiscard]] bool stealTask(std::size_t worker, std::size_t& task);
+
+    [[nodiscard]] static uint64_t packRange(uint64_t begin, uint64_t end);
+
+    std::size_t g_threadCount;
+    std::unique_ptr<TaskRange[]> g_ranges;
+    std::vector<std::thread> g_threads;
+
+    std::mutex g_runMutex;
+    std::mutex g_mutex;
+    std::condition_variable g_wakeCondition;
+    std::condition_variable g_doneCondition;
+    uint64_t g_generation;
+    std::size_t g_activeWorkers;
+    bool g_stop;
+
+    std::function<void(std::size_t)> const* g_task;
+    std::exception_ptr g_exception;
+};
+
+//Pool used by the algorithms when none is given, with one thread per hardware thread
+[[nodiscard]] ThreadPool& default_pool();
+
+//Background thread destroying the elements and freeing the blocks of the chains given to it, in order.
+//A chain is handed over in O(1), so the thread giving it never waits for the destructors.
+class Reclaimer
+{
+public:
+    Reclaimer();
+    Reclaimer(Reclaimer const& r) = delete;
+    Reclaimer(Reclaimer&& r) = delete;
+    //Every chain still pending is reclaimed before the thread is joined
+    ~Reclaimer();
+
+    Reclaimer& operator=(Reclaimer const& r) = delete;
+    Reclaimer& operator=(Reclaimer&& r) = delete;
+
+    //Wait until every chain given before the call is reclaimed
+    void wait();
+    //Chains given but not reclaimed yet
+    [[nodiscard]] std::size_t pending() const;
+
+private:
+    struct Chain
+    {
+        void* _startBlock;
+        void (*_reclaim)(void*) noexcept;
+    };
+
+    void post(Chain chain);
+    void threadLoop();
+
+    mutable std::mutex g_mutex;
+    std::condition_variable g_wakeCondition;
+    std::condition_variable g_doneCondition;
+    std::vector<Chain> g_chains;
+    uint64_t g_postedCount;
+    uint64_t g_reclaimedCount;
+    bool g_stop;
+
+    std::thread g_thread; //Started last, once every other member is ready
+
+    friend struct BlockAccess;
+};
+
+//Reclaimer used by release_async() when none is given, started on first use
+[[nodiscard]] Reclaimer& default_reclaimer();
+
+//Access to the blocks of a gg::List for the parallel algorithms
+struct BlockAccess
+{
+    //One pointer walk over the chain, keeping the non empty blocks
+    template<class TList>
+    [[nodiscard]] static auto directory(TList& list);
+
+    //Call function(element) for every element of the blocks [first, last) in list order
+    template<class TList, class TBlock, class TFunction>
+    static void forEachElement(TBlock* const* first, TBlock* const* last, TFunction&& function);
+    //Same, but stop and return the iterator of the first element where function returns true, or end()
+    template<class TList, class TBlock, class TFunction>
+    static auto visit(TList& list, TBlock* const* first, TBlock* const* last, TFunction&& function);
+
+    //Split the blocks into a few ranges per thread, so a slow range can be stolen around,
+    //function(range, first, last) is called for every range
+    template<class TBlock>
+    [[nodiscard]] static std::size_t rangeCount(ThreadPool const& pool, std::vector<TBlock*> const& blocks);
+    template<class TBlock, class TFunction>
+    static void runRanges(ThreadPool& pool, std::vector<TBlock*> const& blocks, TFunction&& function);
+
+    //Fill an empty list with size elements, packed from the first place of every block.
+    //Every range of blocks is allocated, constructed with construct(place) and linked by one thread, the ranges are then joined
+    template<class TList, class TConstruct>
+    static void fillList(ThreadPool& pool, TList& list, std::size_t size, TConstruct&& construct);
+    //Destroy the elements and free the blocks by ranges, only the start block is kept
+    template<class TList>
+    static void clearList(ThreadPool& pool, TList& list);
+
+    //Give the whole chain to the reclaimer and restart the list from a new empty start block
+    template<class TList>
+    static void releaseList(Reclaimer& reclaimer, TList& list);
+    template<class TList>
+    static void reclaimChain(void* startBlock) noexcept;
+
+    constexpr static std::size_t gRangesPerThread = 4;
+};
+
+//The list is split into ranges of blocks that are given to the threads of the pool.
+//The list must not be modified by other means while an algorithm runs.
+template<class TList, class TFunction>
+void for_each(ThreadPool& pool, TList& list, TFunction function);
+template<class TList, class TFunction>
+void for_each(TList& list, TFunction function);
+
+//In place transformation, every element is replaced by operation(element)
+template<class TList, class TOperation>
+void transform(ThreadPool& pool, TList& list, TOperation operation);
+template<class TList, class TOperation>
+void transform(TList& list, TOperation operation);
+
+//The operation must be associative and commutative, like std::reduce
+template<class TList, class T, class TOperation=std::plus<>>
+[[nodiscard]] T reduce(ThreadPool& pool, TList const& list, T init, TOperation operation={});
+template<class TList, class T, class TOperation=std::plus<>, std::enable_if_t<!std::is_same_v<TList, ThreadPool>, int> = 0>
+[[nodiscard]] T reduce(TList const& list, T init, TOperation operation={});
+
+template<class TList, class TPredicate>
+[[nodiscard]] std::size_t count_if(ThreadPool& pool, TList const& list, TPredicate predicate);
+template<class TList, class TPredicate>
+[[nodiscard]] std::size_t count_if(TList const& list, TPredicate predicate);
+
+//Return the first element in list order where predicate is true, ranges after an already found element are skipped
+template<class TList, class TPredicate>
+[[nodiscard]] auto find_if(ThreadPool& pool, TList& list, TPredicate predicate);
+template<class TList, class TPredicate>
+[[nodiscard]] auto find_if(TList& list, TPredicate predicate);
+
+//Parallel versions of List(size), List(size, value) and clear(), the serial ones stay the default.
+//To destroy a big list in parallel, clear it with the pool before it goes out of scope.
+template<class TList>
+[[nodiscard]] TList make_list(ThreadPool& pool, std::size_t size);
+template<class TList>
+[[nodiscard]] TList make_list(ThreadPool& pool, std::size_t size, typename TList::value_type const& value);
+template<class TList>
+void clear(ThreadPool& pool, TList& list);
+
+//Empty the list in O(1) by giving its blocks to a background reclaimer, that runs the destructors and frees them.
+//The list is usable right after, the elements must not be referenced anymore.
+//To drop a big list without waiting for its destruction, release it before it goes out of scope.
+template<class TList>
+void release_async(Reclaimer& reclaimer, TList& list);
+template<class TList>
+void release_async(TList& list);
+
+#include "C_parallel.inl"
+
+}//end gg::par
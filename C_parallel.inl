@@ -0,0 +1,676 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//ThreadPool
+inline ThreadPool::ThreadPool(std::size_t threadCount) :
+        g_threadCount{std::max<std::size_t>(threadCount, 1)},
+        g_ranges{new TaskRange[g_threadCount]},
+        g_generation{0},
+        g_activeWorkers{0},
+        g_stop{false},
+        g_task{nullptr}
+{
+    this->g_threads.reserve(this->g_threadCount-1);
+    for (std::size_t i = 1; i < this->g_threadCount; ++i)
+    {
+        this->g_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock const lock(this->g_mutex);
+        this->g_stop = true;
+    }
+    this->g_wakeCondition.notify_all();
+    for (auto& thread : this->g_threads)
+    {
+        thread.join();
+    }
+}
+
+inline std::size_t ThreadPool::thread_count() const noexcept
+{
+    return this->g_threadCount;
+}
+
+inline void ThreadPool::run(std::size_t count, std::function<void(std::size_t)> const& task)
+{
+    if (count <= 1 || this->g_threadCount == 1)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::scoped_lock const runLock(this->g_runMutex);
+
+    //Every thread starts with a contiguous part of the tasks
+    for (std::size_t i = 0; i < this->g_threadCount; ++i)
+    {
+        this->g_ranges[i]._range.store(packRange(count*i/this->g_threadCount, count*(i+1)/this->g_threadCount), std::memory_order_relaxed);
+    }
+
+    {
+        std::scoped_lock const lock(this->g_mutex);
+        this->g_task = &task;
+        this->g_exception = nullptr;
+        this->g_activeWorkers = this->g_threads.size();
+        ++this->g_generation;
+    }
+    this->g_wakeCondition.notify_all();
+
+    this->work(0);
+
+    //Wait for every worker to leave the batch, the task can't be referenced after that
+    std::unique_lock lock(this->g_mutex);
+    this->g_doneCondition.wait(lock, [this](){return this->g_activeWorkers == 0;});
+    this->g_task = nullptr;
+
+    if (this->g_exception)
+    {
+        std::rethrow_exception(std::exchange(this->g_exception, nullptr));
+    }
+}
+
+inline void ThreadPool::workerLoop(std::size_t worker)
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(this->g_mutex);
+            this->g_wakeCondition.wait(lock, [&](){return this->g_stop || this->g_generation != generation;});
+            if (this->g_stop)
+            {
+                return;
+            }
+            generation = this->g_generation;
+        }
+
+        this->work(worker);
+
+        std::scoped_lock const lock(this->g_mutex);
+        if (--this->g_activeWorkers == 0)
+        {
+            this->g_doneCondition.notify_one();
+        }
+    }
+}
+inline void ThreadPool::work(std::size_t worker)
+{
+    std::size_t task;
+    while (this->popTask(worker, task) || this->stealTask(worker, task))
+    {
+        try
+        {
+            (*this->g_task)(task);
+        }
+        catch (...)
+        {
+            std::scoped_lock const lock(this->g_mutex);
+            if (!this->g_exception)
+            {
+                this->g_exception = std::current_exception();
+            }
+        }
+    }
+}
+inline bool ThreadPool::popTask(std::size_t worker, std::size_t& task)
+{
+    auto& range = this->g_ranges[worker]._range;
+    uint64_t value = range.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint64_t const begin = value & 0xFFFFFFFF;
+        uint64_t const end = value >> 32;
+        if (begin >= end)
+        {
+            return false;
+        }
+        if (range.compare_exchange_weak(value, packRange(begin+1, end), std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            task = static_cast<std::size_t>(begin);
+            return true;
+        }
+    }
+}
+inline bool ThreadPool::stealTask(std::size_t worker, std::size_t& task)
+{
+    for (std::size_t i = 1; i < this->g_threadCount; ++i)
+    {
+        auto& range = this->g_ranges[(worker+i) % this->g_threadCount]._range;
+        uint64_t value = range.load(std::memory_order_acquire);
+        while (true)
+        {
+            uint64_t const begin = value & 0xFFFFFFFF;
+            uint64_t const end = value >> 32;
+            if (begin >= end)
+            {
+                break;
+            }
+
+            //The back half is taken, its first task is done now and the rest becomes our range
+            uint64_t const middle = begin + (end-begin)/2;
+            if (range.compare_exchange_weak(value, packRange(begin, middle), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                this->g_ranges[worker]._range.store(packRange(middle+1, end), std::memory_order_release);
+                task = static_cast<std::size_t>(middle);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+inline uint64_t ThreadPool::packRange(uint64_t begin, uint64_t end)
+{
+    return begin | (end << 32);
+}
+
+inline ThreadPool& default_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+//Reclaimer
+inline Reclaimer::Reclaimer() :
+        g_postedCount{0},
+        g_reclaimedCount{0},
+        g_stop{false},
+        g_thread{&Reclaimer::threadLoop, this}
+{}
+inline Reclaimer::~Reclaimer()
+{
+    {
+        std::scoped_lock const lock(this->g_mutex);
+        this->g_stop = true;
+    }
+    this->g_wakeCondition.notify_one();
+    this->g_thread.join();
+}
+
+inline void Reclaimer::wait()
+{
+    std::unique_lock lock(this->g_mutex);
+    auto const postedCount = this->g_postedCount;
+    this->g_doneCondition.wait(lock, [&](){return this->g_reclaimedCount >= postedCount;});
+}
+inline std::size_t Reclaimer::pending() const
+{
+    std::scoped_lock const lock(this->g_mutex);
+    return static_cast<std::size_t>(this->g_postedCount - this->g_reclaimedCount);
+}
+
+inline void Reclaimer::post(Chain chain)
+{
+    {
+        std::scoped_lock const lock(this->g_mutex);
+        this->g_chains.push_back(chain);
+        ++this->g_postedCount;
+    }
+    this->g_wakeCondition.notify_one();
+}
+inline void Reclaimer::threadLoop()
+{
+    //The chains are taken by batch, the two vectors are swapped so their capacity is kept
+    std::vector<Chain> chains;
+    while (true)
+    {
+        {
+            std::unique_lock lock(this->g_mutex);
+            this->g_wakeCondition.wait(lock, [this](){return this->g_stop || !this->g_chains.empty();});
+            if (this->g_chains.empty())
+            {//Stopping with nothing left
+                return;
+            }
+            chains.swap(this->g_chains);
+        }
+
+        for (auto const& chain : chains)
+        {
+            chain._reclaim(chain._startBlock);
+        }
+
+        {
+            std::scoped_lock const lock(this->g_mutex);
+            this->g_reclaimedCount += chains.size();
+        }
+        this->g_doneCondition.notify_all();
+        chains.clear();
+    }
+}
+
+inline Reclaimer& default_reclaimer()
+{
+    static Reclaimer reclaimer;
+    return reclaimer;
+}
+
+//BlockAccess
+template<class TList>
+auto BlockAccess::directory(TList& list)
+{
+    using Block = typename std::remove_const_t<TList>::Block;
+
+    std::vector<Block*> blocks;
+    for (Block* block = list.g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        if (block->_occupiedFlags != 0)
+        {
+            blocks.push_back(block);
+        }
+    }
+    return blocks;
+}
+
+template<class TList, class TBlock, class TFunction>
+auto BlockAccess::visit(TList& list, TBlock* const* first, TBlock* const* last, TFunction&& function)
+{
+    using ListType = std::remove_const_t<TList>;
+    using Iterator = std::conditional_t<std::is_const_v<TList>, typename ListType::const_iterator, typename ListType::iterator>;
+    using Element = std::conditional_t<std::is_const_v<TList>, typename ListType::value_type const, typename ListType::value_type>;
+
+    for (; first != last; ++first)
+    {
+        TBlock* block = *first;
+        auto* data = reinterpret_cast<Element*>(&block->_data);
+        for (auto flags = block->_occupiedFlags; flags != 0; flags &= static_cast<decltype(flags)>(flags-1))
+        {
+            auto const index = ListType::lowestIndex(flags);
+            if (function(data[index]))
+            {
+                using Location = typename ListType::DataLocation;
+                return Iterator{block, Location{const_cast<typename ListType::value_type*>(data + index),
+                                                static_cast<decltype(flags)>(static_cast<decltype(flags)>(1) << index)}};
+            }
+        }
+    }
+    return list.end();
+}
+
+template<class TList, class TBlock, class TFunction>
+void BlockAccess::forEachElement(TBlock* const* first, TBlock* const* last, TFunction&& function)
+{
+    using ListType = std::remove_const_t<TList>;
+    using Element = std::conditional_t<std::is_const_v<TList>, typename ListType::value_type const, typename ListType::value_type>;
+    using Flags = std::remove_cv_t<decltype((*first)->_occupiedFlags)>;
+
+    for (; first != last; ++first)
+    {
+        TBlock* block = *first;
+        auto* data = reinterpret_cast<Element*>(&block->_data);
+        Flags flags = block->_occupiedFlags;
+        if (flags == std::numeric_limits<Flags>::max())
+        {//A full block is a plain array
+            for (std::size_t i = 0; i <= ListType::gIndexLast; ++i)
+            {
+                function(data[i]);
+            }
+            continue;
+        }
+        for (; flags != 0; flags &= static_cast<Flags>(flags-1))
+        {
+            function(data[ListType::lowestIndex(flags)]);
+        }
+    }
+}
+
+template<class TBlock>
+std::size_t BlockAccess::rangeCount(ThreadPool const& pool, std::vector<TBlock*> const& blocks)
+{
+    return std::min(blocks.size(), pool.thread_count()*gRangesPerThread);
+}
+template<class TBlock, class TFunction>
+void BlockAccess::runRanges(ThreadPool& pool, std::vector<TBlock*> const& blocks, TFunction&& function)
+{
+    std::size_t const count = rangeCount(pool, blocks);
+    pool.run(count, [&](std::size_t range){
+        function(range, blocks.data() + blocks.size()*range/count, blocks.data() + blocks.size()*(range+1)/count);
+    });
+}
+
+template<class TList, class TConstruct>
+void BlockAccess::fillList(ThreadPool& pool, TList& list, std::size_t size, TConstruct&& construct)
+{
+    using Block = typename TList::Block;
+    using Flags = std::remove_cv_t<decltype(std::declval<Block>()._occupiedFlags)>;
+    constexpr std::size_t blockSize = TList::gIndexLast+1;
+
+    struct Chain
+    {
+        Block* _first{nullptr};
+        Block* _last{nullptr};
+        std::size_t _count{0};
+    };
+
+    std::size_t const blockCount = (size + blockSize-1) / blockSize;
+    std::size_t const ranges = std::min(blockCount, pool.thread_count()*gRangesPerThread);
+    std::vector<Chain> chains(ranges);
+
+    //Join what was built, even after an exception, so the list can destroy it
+    auto const joinChains = [&](){
+        Block* lastBlock = nullptr;
+        std::size_t count = 0;
+        for (auto const& chain : chains)
+        {
+            if (chain._first == nullptr)
+            {
+                continue;
+            }
+            if (lastBlock != nullptr)
+            {
+                lastBlock->_nextBlock = chain._first;
+                chain._first->_lastBlock = lastBlock;
+            }
+            lastBlock = chain._last;
+            count += chain._count;
+        }
+        if (lastBlock != nullptr)
+        {
+            list.g_lastBlock = lastBlock;
+        }
+        list.g_dataSize = count;
+        list.refreshCacheFrontIndex();
+        list.refreshCacheBackIndex();
+    };
+
+    try
+    {
+        pool.run(ranges, [&](std::size_t range){
+            auto& chain = chains[range];
+            std::size_t const lastBlock = blockCount*(range+1)/ranges;
+            for (std::size_t b = blockCount*range/ranges; b < lastBlock; ++b)
+            {
+                Block* block = b == 0 ? list.g_startBlock : TList::allocateBlock();
+                if (chain._last != nullptr)
+                {
+                    chain._last->_nextBlock = block;
+                    block->_lastBlock = chain._last;
+                }
+                else
+                {
+                    chain._first = block;
+                }
+                chain._last = block;
+
+                auto* data = reinterpret_cast<typename TList::value_type*>(&block->_data);
+                std::size_t const count = std::min(blockSize, size - b*blockSize);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    construct(data + i);
+                    block->_occupiedFlags |= static_cast<Flags>(static_cast<Flags>(1) << i);
+                    ++chain._count;
+                }
+            }
+        });
+    }
+    catch (...)
+    {
+        joinChains();
+        throw;
+    }
+    joinChains();
+}
+template<class TList>
+void BlockAccess::clearList(ThreadPool& pool, TList& list)
+{
+    using Block = typename TList::Block;
+    using Flags = std::remove_cv_t<decltype(std::declval<Block>()._occupiedFlags)>;
+
+    //Without destructors to run, only the frees are left and they don't scale
+    if (std::is_trivially_destructible_v<typename TList::value_type> ||
+        list.g_startBlock == nullptr || list.g_startBlock == list.g_lastBlock)
+    {
+        list.clear();
+        return;
+    }
+
+    std::vector<Block*> blocks;
+    for (Block* block = list.g_startBlock; block != nullptr; block = block->_nextBlock)
+    {
+        blocks.push_back(block);
+    }
+
+    //The start block is kept, so it's only emptied
+    Block* startBlock = list.g_startBlock;
+    runRanges(pool, blocks, [&](std::size_t, Block* const* first, Block* const* last){
+        for (; first != last; ++first)
+        {
+            Block* block = *first;
+            static_cast<void>(TList::destroyElements(block, std::numeric_limits<Flags>::max()));
+            if (block != startBlock)
+            {
+                delete block;
+            }
+        }
+    });
+
+    startBlock->_nextBlock = nullptr;
+    list.g_lastBlock = startBlock;
+    TList::freeSpareBlocks(list.g_spareBlocks);
+    list.g_dataSize = 0;
+    list.g_compactCursor = nullptr;
+    list.g_cacheBackIndex = TList::gIndexMid;
+    list.g_cacheFrontIndex = TList::gIndexMid-1;
+}
+
+template<class TList>
+void BlockAccess::releaseList(Reclaimer& reclaimer, TList& list)
+{
+    using Block = typename TList::Block;
+
+    //Nothing is changed before the new start block exists and the chain is queued, as both can throw
+    std::unique_ptr<Block> startBlock{TList::allocateBlock()};
+    if (list.g_startBlock != nullptr)
+    {//A moved from list has no chain to give
+        //The empty spare blocks are freed with the chain, they must be linked before it's given
+        list.g_lastBlock->_nextBlock = list.g_spareBlocks;
+        try
+        {
+            reclaimer.post({list.g_startBlock, &BlockAccess::reclaimChain<TList>});
+        }
+        catch (...)
+        {
+            list.g_lastBlock->_nextBlock = nullptr;
+            throw;
+        }
+        list.g_spareBlocks = nullptr;
+    }
+
+    list.g_startBlock = startBlock.release();
+    list.g_lastBlock = list.g_startBlock;
+    list.g_dataSize = 0;
+    list.g_compactCursor = nullptr;
+    list.g_cacheBackIndex = TList::gIndexMid;
+    list.g_cacheFrontIndex = TList::gIndexMid-1;
+}
+template<class TList>
+void BlockAccess::reclaimChain(void* startBlock) noexcept
+{
+    using Block = typename TList::Block;
+    using Flags = std::remove_cv_t<decltype(std::declval<Block>()._occupiedFlags)>;
+
+    auto* block = static_cast<Block*>(startBlock);
+    while (block != nullptr)
+    {
+        auto* nextBlock = block->_nextBlock;
+        static_cast<void>(TList::destroyElements(block, std::numeric_limits<Flags>::max()));
+        delete block;
+        block = nextBlock;
+    }
+}
+
+//Algorithms
+template<class TList, class TFunction>
+void for_each(ThreadPool& pool, TList& list, TFunction function)
+{
+    auto const blocks = BlockAccess::directory(list);
+    BlockAccess::runRanges(pool, blocks, [&](std::size_t, auto const* first, auto const* last){
+        BlockAccess::forEachElement<TList>(first, last, function);
+    });
+}
+template<class TList, class TFunction>
+void for_each(TList& list, TFunction function)
+{
+    for_each(default_pool(), list, std::move(function));
+}
+
+template<class TList, class TOperation>
+void transform(ThreadPool& pool, TList& list, TOperation operation)
+{
+    for_each(pool, list, [&](auto& element){
+        element = operation(element);
+    });
+}
+template<class TList, class TOperation>
+void transform(TList& list, TOperation operation)
+{
+    transform(default_pool(), list, std::move(operation));
+}
+
+template<class TList, class T, class TOperation>
+T reduce(ThreadPool& pool, TList const& list, T init, TOperation operation)
+{
+    auto const blocks = BlockAccess::directory(list);
+    std::size_t const ranges = BlockAccess::rangeCount(pool, blocks);
+
+    //Every range starts from its first element, so no identity value is needed
+    std::vector<std::optional<T>> results(ranges);
+    BlockAccess::runRanges(pool, blocks, [&](std::size_t range, auto const* first, auto const* last){
+        auto& result = results[range];
+        BlockAccess::forEachElement<TList const>(first, last, [&](auto const& element){
+            if (result)
+            {
+                *result = operation(std::move(*result), element);
+            }
+            else
+            {
+                result.emplace(element);
+            }
+        });
+    });
+
+    for (auto& result : results)
+    {
+        init = operation(std::move(init), std::move(*result));
+    }
+    return init;
+}
+template<class TList, class T, class TOperation, std::enable_if_t<!std::is_same_v<TList, ThreadPool>, int>>
+T reduce(TList const& list, T init, TOperation operation)
+{
+    return reduce(default_pool(), list, std::move(init), std::move(operation));
+}
+
+template<class TList, class TPredicate>
+std::size_t count_if(ThreadPool& pool, TList const& list, TPredicate predicate)
+{
+    auto const blocks = BlockAccess::directory(list);
+    std::atomic<std::size_t> count{0};
+    BlockAccess::runRanges(pool, blocks, [&](std::size_t, auto const* first, auto const* last){
+        std::size_t matches = 0;
+        BlockAccess::forEachElement<TList const>(first, last, [&](auto const& element){
+            matches += predicate(element) ? 1 : 0;
+        });
+        count.fetch_add(matches, std::memory_order_relaxed);
+    });
+    return count.load(std::memory_order_relaxed);
+}
+template<class TList, class TPredicate>
+std::size_t count_if(TList const& list, TPredicate predicate)
+{
+    return count_if(default_pool(), list, std::move(predicate));
+}
+
+template<class TList, class TPredicate>
+auto find_if(ThreadPool& pool, TList& list, TPredicate predicate)
+{
+    auto const blocks = BlockAccess::directory(list);
+    std::size_t const ranges = BlockAccess::rangeCount(pool, blocks);
+
+    std::vector<decltype(list.end())> results(ranges, list.end());
+    std::atomic<std::size_t> foundRange{std::numeric_limits<std::size_t>::max()};
+    BlockAccess::runRanges(pool, blocks, [&](std::size_t range, auto const* first, auto const* last){
+        if (range > foundRange.load(std::memory_order_relaxed))
+        {//An earlier range already has a match
+            return;
+        }
+
+        results[range] = BlockAccess::visit(list, first, last, [&](auto const& element){
+            return predicate(element);
+        });
+        if (results[range] != list.end())
+        {
+            auto found = foundRange.load(std::memory_order_relaxed);
+            while (range < found && !foundRange.compare_exchange_weak(found, range, std::memory_order_relaxed))
+            {}
+        }
+    });
+
+    auto const found = foundRange.load(std::memory_order_relaxed);
+    return found < ranges ? results[found] : list.end();
+}
+template<class TList, class TPredicate>
+auto find_if(TList& list, TPredicate predicate)
+{
+    return find_if(default_pool(), list, std::move(predicate));
+}
+
+template<class TList>
+TList make_list(ThreadPool& pool, std::size_t size)
+{
+    TList list;
+    BlockAccess::fillList(pool, list, size, [](typename TList::value_type* data){
+        new (data) typename TList::value_type();
+    });
+    return list;
+}
+template<class TList>
+TList make_list(ThreadPool& pool, std::size_t size, typename TList::value_type const& value)
+{
+    TList list;
+    BlockAccess::fillList(pool, list, size, [&value](typename TList::value_type* data){
+        new (data) typename TList::value_type(value);
+    });
+    return list;
+}
+template<class TList>
+void clear(ThreadPool& pool, TList& list)
+{
+    BlockAccess::clearList(pool, list);
+}
+
+template<class TList>
+void release_async(Reclaimer& reclaimer, TList& list)
+{
+    BlockAccess::releaseList(reclaimer, list);
+}
+template<class TList>
+void release_async(TList& list)
+{
+    BlockAccess::releaseList(default_reclaimer(), list);
+}
@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "C_list.hpp"
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+
+namespace gg
+{
+
+//List where every thread appends to its own shard (a gg::List) without any synchronization.
+//A thread takes a lock only the first time it appends, to register its shard, the shard is then found in a thread local cache.
+//Iterating, counting, clearing and consolidating visit all the shards and must not happen while other threads are appending.
+template<class T, class TBlockSize=uint16_t, InsertPolicies TInsertPolicy=InsertPolicies::SHIFT>
+class ShardedList
+{
+public:
+    using list_type = List<T, TBlockSize, TInsertPolicy>;
+    using value_type = T;
+
+private:
+    struct alignas(64) Shard //Shards of different threads never share a cache line
+    {
+        std::thread::id _owner;
+        list_type _list;
+    };
+    using ShardPointer = std::unique_ptr<Shard>;
+
+    struct CacheEntry
+    {
+        uint64_t _listId{0};
+        Shard* _shard{nullptr};
+    };
+    constexpr static std::size_t gCacheSize = 8;
+
+    template<bool TConst>
+    class shard_iterator
+    {
+        using list_iterator = std::conditional_t<TConst, typename list_type::const_iterator, typename list_type::iterator>;
+        using list_reference = std::conditional_t<TConst, list_type const&, list_type&>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = std::conditional_t<TConst, value_type const*, value_type*>;
+        using reference         = std::conditional_t<TConst, value_type const&, value_type&>;
+
+        shard_iterator() = default;
+
+        shard_iterator& operator++();
+        shard_iterator operator++(int) {auto copy=*this; this->operator++(); return copy;}
+
+        [[nodiscard]] reference operator*() const {return *this->_it;}
+        [[nodiscard]] pointer operator->() const {return &(*this->_it);}
+
+        [[nodiscard]] bool operator==(shard_iterator const& r) const;
+        [[nodiscard]] bool operator!=(shard_iterator const& r) const;
+
+    private:
+        shard_iterator(ShardPointer const* shard, ShardPointer const* shardEnd);
+        void skipEmptyShards();
+        [[nodiscard]] list_reference shardList() const {return (*this->_shard)->_list;}
+
+        ShardPointer const* _shard{nullptr};
+        ShardPointer const* _shardEnd{nullptr};
+        list_iterator _it{};
+        friend ShardedList;
+    };
+
+public:
+    using iterator = shard_iterator<false>;
+    using const_iterator = shard_iterator<true>;
+
+    ShardedList();
+    ShardedList(ShardedList const& r) = delete;
+    ShardedList(ShardedList&& r) = delete;
+    ~ShardedList() = default;
+
+    ShardedList& operator=(ShardedList const& r) = delete;
+    ShardedList& operator=(ShardedList&& r) = delete;
+
+    template<class U>
+    void push_back(U&& value);
+    template<class... TArgs>
+    T& emplace_back(TArgs&&... value);
+
+    //The shard of the calling thread, it can be modified freely by this thread
+    [[nodiscard]] list_type& local();
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t block_count() const noexcept;
+    [[nodiscard]] std::size_t shard_count() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    template<class TFunction>
+    void for_each_block(TFunction&& function);
+    template<class TFunction>
+    void for_each_block(TFunction&& function) const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] iterator end();
+
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator cbegin() const;
+    [[nodiscard]] const_iterator end() const;
+    [[nodiscard]] const_iterator cend() const;
+
+    void clear();
+    //Splice every shard, in registration order, into one list by relinking their blocks, the shards are left empty
+    [[nodiscard]] list_type consolidate();
+
+private:
+    [[nodiscard]] Shard& localShard();
+    [[nodiscard]] Shard& registerShard();
+    [[nodiscard]] static CacheEntry* threadCache();
+
+    inline static std::atomic<uint64_t> gNextId{1};
+
+    uint64_t const g_id; //Never reused, so a stale cache entry of a destroyed list can't match
+    std::mutex g_mutex;
+    std::vector<ShardPointer> g_shards;
+};
+
+#include "C_shardedList.inl"
+
+}//end gg
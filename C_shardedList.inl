@@ -0,0 +1,242 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//shard_iterator
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TConst>
+ShardedList<T, TBlockSize, TInsertPolicy>::shard_iterator<TConst>::shard_iterator(ShardPointer const* shard, ShardPointer const* shardEnd) :
+        _shard(shard),
+        _shardEnd(shardEnd)
+{
+    if (this->_shard != this->_shardEnd)
+    {
+        this->_it = this->shardList().begin();
+        this->skipEmptyShards();
+    }
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TConst>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::template shard_iterator<TConst>& ShardedList<T, TBlockSize, TInsertPolicy>::shard_iterator<TConst>::operator++()
+{
+    ++this->_it;
+    this->skipEmptyShards();
+    return *this;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TConst>
+bool ShardedList<T, TBlockSize, TInsertPolicy>::shard_iterator<TConst>::operator==(shard_iterator const& r) const
+{
+    return this->_shard == r._shard && (this->_shard == this->_shardEnd || this->_it == r._it);
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TConst>
+bool ShardedList<T, TBlockSize, TInsertPolicy>::shard_iterator<TConst>::operator!=(shard_iterator const& r) const
+{
+    return !this->operator==(r);
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<bool TConst>
+void ShardedList<T, TBlockSize, TInsertPolicy>::shard_iterator<TConst>::skipEmptyShards()
+{
+    while (this->_it == this->shardList().end())
+    {
+        if (++this->_shard == this->_shardEnd)
+        {
+            this->_it = list_iterator{};
+            return;
+        }
+        this->_it = this->shardList().begin();
+    }
+}
+
+//ShardedList
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+ShardedList<T, TBlockSize, TInsertPolicy>::ShardedList() :
+        g_id{gNextId.fetch_add(1, std::memory_order_relaxed)}
+{}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class U>
+void ShardedList<T, TBlockSize, TInsertPolicy>::push_back(U&& value)
+{
+    this->localShard()._list.push_back(std::forward<U>(value));
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class... TArgs>
+T& ShardedList<T, TBlockSize, TInsertPolicy>::emplace_back(TArgs&&... value)
+{
+    return this->localShard()._list.emplace_back(std::forward<TArgs>(value)...);
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::list_type& ShardedList<T, TBlockSize, TInsertPolicy>::local()
+{
+    return this->localShard()._list;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+std::size_t ShardedList<T, TBlockSize, TInsertPolicy>::size() const noexcept
+{
+    std::size_t count = 0;
+    for (auto const& shard : this->g_shards)
+    {
+        count += shard->_list.size();
+    }
+    return count;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+std::size_t ShardedList<T, TBlockSize, TInsertPolicy>::block_count() const noexcept
+{
+    std::size_t count = 0;
+    for (auto const& shard : this->g_shards)
+    {
+        count += shard->_list.block_count();
+    }
+    return count;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+std::size_t ShardedList<T, TBlockSize, TInsertPolicy>::shard_count() const noexcept
+{
+    return this->g_shards.size();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+bool ShardedList<T, TBlockSize, TInsertPolicy>::empty() const noexcept
+{
+    for (auto const& shard : this->g_shards)
+    {
+        if (!shard->_list.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TFunction>
+void ShardedList<T, TBlockSize, TInsertPolicy>::for_each_block(TFunction&& function)
+{
+    for (auto& shard : this->g_shards)
+    {
+        shard->_list.for_each_block(function);
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+template<class TFunction>
+void ShardedList<T, TBlockSize, TInsertPolicy>::for_each_block(TFunction&& function) const
+{
+    for (auto const& shard : this->g_shards)
+    {
+        static_cast<list_type const&>(shard->_list).for_each_block(function);
+    }
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::iterator ShardedList<T, TBlockSize, TInsertPolicy>::begin()
+{
+    return iterator{this->g_shards.data(), this->g_shards.data() + this->g_shards.size()};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::iterator ShardedList<T, TBlockSize, TInsertPolicy>::end()
+{
+    auto const* shardEnd = this->g_shards.data() + this->g_shards.size();
+    return iterator{shardEnd, shardEnd};
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::const_iterator ShardedList<T, TBlockSize, TInsertPolicy>::begin() const
+{
+    return const_iterator{this->g_shards.data(), this->g_shards.data() + this->g_shards.size()};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::const_iterator ShardedList<T, TBlockSize, TInsertPolicy>::cbegin() const
+{
+    return this->begin();
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::const_iterator ShardedList<T, TBlockSize, TInsertPolicy>::end() const
+{
+    auto const* shardEnd = this->g_shards.data() + this->g_shards.size();
+    return const_iterator{shardEnd, shardEnd};
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::const_iterator ShardedList<T, TBlockSize, TInsertPolicy>::cend() const
+{
+    return this->end();
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+void ShardedList<T, TBlockSize, TInsertPolicy>::clear()
+{
+    for (auto& shard : this->g_shards)
+    {
+        shard->_list.clear();
+    }
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::list_type ShardedList<T, TBlockSize, TInsertPolicy>::consolidate()
+{
+    list_type result;
+    for (auto& shard : this->g_shards)
+    {
+        result.splice(result.cend(), shard->_list);
+    }
+    return result;
+}
+
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::Shard& ShardedList<T, TBlockSize, TInsertPolicy>::localShard()
+{
+    auto& entry = threadCache()[this->g_id % gCacheSize];
+    if (entry._listId != this->g_id)
+    {
+        entry._shard = &this->registerShard();
+        entry._listId = this->g_id;
+    }
+    return *entry._shard;
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::Shard& ShardedList<T, TBlockSize, TInsertPolicy>::registerShard()
+{
+    auto const owner = std::this_thread::get_id();
+    std::scoped_lock const lock(this->g_mutex);
+
+    //The shard can already exist if the cache entry was taken by an other list
+    for (auto& shard : this->g_shards)
+    {
+        if (shard->_owner == owner)
+        {
+            return *shard;
+        }
+    }
+    return *this->g_shards.emplace_back(new Shard{owner, list_type{}});
+}
+template<class T, class TBlockSize, InsertPolicies TInsertPolicy>
+typename ShardedList<T, TBlockSize, TInsertPolicy>::CacheEntry* ShardedList<T, TBlockSize, TInsertPolicy>::threadCache()
+{
+    thread_local CacheEntry cache[gCacheSize];
+    return cache;
+}
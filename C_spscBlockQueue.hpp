@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace gg
+{
+
+//Single producer single consumer queue made of the same blocks as gg::List.
+//The producer fills the places of the tail block in order and publishes each one with a release store of the occupancy bitset,
+//the consumer reads the bitset with acquire. A block drained by the consumer is handed back to the producer for reuse,
+//so once enough blocks are allocated, the queue doesn't allocate anymore.
+template<class T, class TBlockSize=uint16_t>
+class SpscBlockQueue
+{
+    static_assert(std::is_fundamental_v<TBlockSize> && std::is_unsigned_v<TBlockSize>, "TBlockSize must be fundamental and unsigned type !");
+    static_assert(std::atomic<TBlockSize>::is_always_lock_free, "TBlockSize must be lock free as an atomic !");
+
+    struct Block
+    {
+        std::atomic<TBlockSize> _occupiedFlags{0};
+        std::atomic<Block*> _nextBlock{nullptr};
+        alignas(T) uint8_t _data[sizeof(T)*sizeof(TBlockSize)*8];
+    };
+    using BlockIndex = unsigned short;
+
+    constexpr static BlockIndex gIndexLast = sizeof(TBlockSize) * 8 - 1;
+
+public:
+    using value_type = T;
+
+    SpscBlockQueue();
+    SpscBlockQueue(SpscBlockQueue const& r) = delete;
+    SpscBlockQueue(SpscBlockQueue&& r) = delete;
+    ~SpscBlockQueue();
+
+    SpscBlockQueue& operator=(SpscBlockQueue const& r) = delete;
+    SpscBlockQueue& operator=(SpscBlockQueue&& r) = delete;
+
+    //Producer side
+    template<class U>
+    void push(U&& value);
+    template<class... TArgs>
+    void emplace(TArgs&&... value);
+    [[nodiscard]] std::size_t allocated_block_count() const noexcept;
+
+    //Consumer side
+    [[nodiscard]] bool try_pop(T& value);
+    [[nodiscard]] bool empty() const;
+
+private:
+    [[nodiscard]] Block* takeBlock();
+    void recycleBlock(Block* block);
+    static void freeChain(Block* block);
+
+    //Producer
+    alignas(64) Block* g_tailBlock;
+    BlockIndex g_tailIndex;
+    TBlockSize g_tailFlags;
+    Block* g_spareBlocks;
+    std::size_t g_allocatedBlocks;
+
+    //Consumer
+    alignas(64) Block* g_headBlock;
+    BlockIndex g_headIndex;
+
+    //Drained blocks given back by the consumer
+    alignas(64) std::atomic<Block*> g_recycledBlocks;
+};
+
+#include "C_spscBlockQueue.inl"
+
+}//end gg
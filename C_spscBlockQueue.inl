@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Guillaume Guillet
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+template<class T, class TBlockSize>
+SpscBlockQueue<T, TBlockSize>::SpscBlockQueue() :
+        g_tailBlock{new Block},
+        g_tailIndex{0},
+        g_tailFlags{0},
+        g_spareBlocks{nullptr},
+        g_allocatedBlocks{1},
+
+        g_headBlock{g_tailBlock},
+        g_headIndex{0},
+
+        g_recycledBlocks{nullptr}
+{}
+template<class T, class TBlockSize>
+SpscBlockQueue<T, TBlockSize>::~SpscBlockQueue()
+{
+    //The elements left are the published places from the consumer position
+    for (Block* block = this->g_headBlock; block != nullptr; block = block->_nextBlock.load(std::memory_order_relaxed))
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            auto const flags = block->_occupiedFlags.load(std::memory_order_relaxed);
+            BlockIndex const first = block == this->g_headBlock ? this->g_headIndex : 0;
+            for (BlockIndex i = first; i <= gIndexLast; ++i)
+            {
+                if ((flags & static_cast<TBlockSize>(static_cast<TBlockSize>(1) << i)) != 0)
+                {
+                    reinterpret_cast<T*>(block->_data)[i].~T();
+                }
+            }
+        }
+    }
+
+    freeChain(this->g_headBlock);
+    freeChain(this->g_spareBlocks);
+    freeChain(this->g_recycledBlocks.load(std::memory_order_relaxed));
+}
+
+template<class T, class TBlockSize>
+template<class U>
+void SpscBlockQueue<T, TBlockSize>::push(U&& value)
+{
+    this->emplace(std::forward<U>(value));
+}
+template<class T, class TBlockSize>
+template<class... TArgs>
+void SpscBlockQueue<T, TBlockSize>::emplace(TArgs&&... value)
+{
+    if (this->g_tailIndex > gIndexLast)
+    {
+        Block* block = this->takeBlock();
+        this->g_tailBlock->_nextBlock.store(block, std::memory_order_release);
+        this->g_tailBlock = block;
+        this->g_tailIndex = 0;
+        this->g_tailFlags = 0;
+    }
+
+    new (reinterpret_cast<T*>(this->g_tailBlock->_data) + this->g_tailIndex) T(std::forward<TArgs>(value)...);
+
+    //Only the producer writes the bitset of a block in use, a plain store publishes the place
+    this->g_tailFlags |= static_cast<TBlockSize>(static_cast<TBlockSize>(1) << this->g_tailIndex++);
+    this->g_tailBlock->_occupiedFlags.store(this->g_tailFlags, std::memory_order_release);
+}
+template<class T, class TBlockSize>
+std::size_t SpscBlockQueue<T, TBlockSize>::allocated_block_count() const noexcept
+{
+    return this->g_allocatedBlocks;
+}
+
+template<class T, class TBlockSize>
+bool SpscBlockQueue<T, TBlockSize>::try_pop(T& value)
+{
+    if (this->g_headIndex > gIndexLast)
+    {//The block is drained, move to the next one if the producer linked it
+        Block* nextBlock = this->g_headBlock->_nextBlock.load(std::memory_order_acquire);
+        if (nextBlock == nullptr)
+        {
+            return false;
+        }
+        this->recycleBlock(this->g_headBlock);
+        this->g_headBlock = nextBlock;
+        this->g_headIndex = 0;
+    }
+
+    auto const position = static_cast<TBlockSize>(static_cast<TBlockSize>(1) << this->g_headIndex);
+    if ((this->g_headBlock->_occupiedFlags.load(std::memory_order_acquire) & position) == 0)
+    {
+        return false;
+    }
+
+    //The place is only consumed once the assignment succeeded, a throwing one leaves the element in the queue
+    T* data = reinterpret_cast<T*>(this->g_headBlock->_data) + this->g_headIndex;
+    value = std::move(*data);
+    data->~T();
+    ++this->g_headIndex;
+    return true;
+}
+template<class T, class TBlockSize>
+bool SpscBlockQueue<T, TBlockSize>::empty() const
+{
+    Block const* block = this->g_headBlock;
+    BlockIndex index = this->g_headIndex;
+    if (index > gIndexLast)
+    {
+        block = block->_nextBlock.load(std::memory_order_acquire);
+        if (block == nullptr)
+        {
+            return true;
+        }
+        index = 0;
+    }
+    return (block->_occupiedFlags.load(std::memory_order_acquire) & static_cast<TBlockSize>(static_cast<TBlockSize>(1) << index)) == 0;
+}
+
+template<class T, class TBlockSize>
+typename SpscBlockQueue<T, TBlockSize>::Block* SpscBlockQueue<T, TBlockSize>::takeBlock()
+{
+    if (this->g_spareBlocks == nullptr)
+    {//Take every block recycled so far at once
+        this->g_spareBlocks = this->g_recycledBlocks.exchange(nullptr, std::memory_order_acquire);
+        if (this->g_spareBlocks == nullptr)
+        {
+            ++this->g_allocatedBlocks;
+            return new Block;
+        }
+    }
+
+    Block* block = this->g_spareBlocks;
+    this->g_spareBlocks = block->_nextBlock.load(std::memory_order_relaxed);
+    block->_nextBlock.store(nullptr, std::memory_order_relaxed);
+    block->_occupiedFlags.store(0, std::memory_order_relaxed);
+    return block;
+}
+template<class T, class TBlockSize>
+void SpscBlockQueue<T, TBlockSize>::recycleBlock(Block* block)
+{
+    Block* recycledBlocks = this->g_recycledBlocks.load(std::memory_order_relaxed);
+    do
+    {
+        block->_nextBlock.store(recycledBlocks, std::memory_order_relaxed);
+    }
+    while (!this->g_recycledBlocks.compare_exchange_weak(recycledBlocks, block, std::memory_order_release, std::memory_order_relaxed));
+}
+template<class T, class TBlockSize>
+void SpscBlockQueue<T, TBlockSize>::freeChain(Block* block)
+{
+    while (block != nullptr)
+    {
+        Block* nextBlock = block->_nextBlock.load(std::memory_order_relaxed);
+        delete block;
+        block = nextBlock;
+    }
+}
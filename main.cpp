@@ -1,6 +1,10 @@
 #include <algorithm>
 
 #include "C_list.hpp"
+#include "C_concurrentAppendList.hpp"
+#include "C_shardedList.hpp"
+#include "C_spscBlockQueue.hpp"
+#include "C_parallel.hpp"
 #include <list>
 #include <vector>
 #include <deque>
@@ -11,6 +15,9 @@
 #include <cmath>
 #include <iostream>
 #include <array>
+#include <random>
+#include <thread>
+#include <mutex>
 
 #include <matplot/matplot.h>
 
@@ -153,6 +160,37 @@ void test_destruction(std::string_view containerName, LogSteps const& steps)
     std::cout << "---" << std::endl;
 }
 template<class TContainer>
+void test_releaseAsync(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: release_async then destruction, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        auto* testContainer = new TContainer{iterations};
+        CHRONO_START
+        gg::par::release_async(*testContainer);
+        delete testContainer;
+        CHRONO_STOP
+        CHRONO_TIME
+
+        //The reclaimer must not slow down the next measure
+        gg::par::default_reclaimer().wait();
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TContainer>
 void test_erase(std::string_view containerName, LogSteps const& steps)
 {
     std::cout << "test: erase, on " << containerName << std::endl;
@@ -210,49 +248,473 @@ void test_insert(std::string_view containerName, LogSteps const& steps)
         CHRONO_START
         for (uint32_t i = 0; i < iterations; ++i)
         {
-            testContainer.insert(itMiddle, typename TContainer::value_type{});
+            itMiddle = std::next(testContainer.insert(itMiddle, typename TContainer::value_type{}));
         }
         CHRONO_STOP
         CHRONO_TIME
 
-        resultX.emplace_back(iterations);
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TContainer>
+void test_iterations(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: iterations, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        TContainer testContainer{iterations};
+
+        CHRONO_START
+        for (auto it=testContainer.begin(); it!=testContainer.end(); ++it) {}
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+
+template<class TContainer>
+void test_insertRandom(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: insert random, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        std::mt19937 random{iterations};
+        TContainer testContainer{iterations};
+        auto it = testContainer.begin();
+        std::size_t index = 0;
+
+        //The insertion point does a random walk so the walking cost stays small compared to the insertions
+        CHRONO_START
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            auto const offset = static_cast<int>(random() % 33) - 16;
+            if (offset < 0)
+            {
+                for (int a=0; a<-offset && index > 0; ++a, --index)
+                {
+                    --it;
+                }
+            }
+            else
+            {
+                for (int a=0; a<offset && index < testContainer.size(); ++a, ++index)
+                {
+                    ++it;
+                }
+            }
+            it = testContainer.insert(it, typename TContainer::value_type{});
+        }
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+
+template<class TValue>
+TValue BuildRandomValue(std::mt19937& random)
+{
+    if constexpr (std::is_same_v<TValue, std::string>)
+    {
+        return std::to_string(random());
+    }
+    else
+    {
+        return static_cast<TValue>(random());
+    }
+}
+
+template<class TContainer>
+void SortContainer(TContainer& container)
+{
+    container.sort();
+}
+template<class TValue>
+void SortContainer(std::vector<TValue>& container)
+{
+    std::stable_sort(container.begin(), container.end());
+}
+
+template<class TContainer>
+void test_sort(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: sort, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        std::mt19937 random{iterations};
+        TContainer testContainer{};
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            testContainer.push_back(BuildRandomValue<typename TContainer::value_type>(random));
+        }
+
+        CHRONO_START
+        SortContainer(testContainer);
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+
+template<class TBlockSize>
+void test_randomErase(std::string_view containerName, LogSteps const& steps, float densityFloor)
+{
+    std::cout << "test: random erase, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        std::mt19937 random{iterations};
+        gg::List<uint32_t, TBlockSize> testContainer{iterations};
+        testContainer.set_density_floor(densityFloor);
+
+        //Every pass erase half of the remaining elements at random
+        CHRONO_START
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            for (auto it=testContainer.begin(); it!=testContainer.end();)
+            {
+                it = (random() & 1) != 0 ? testContainer.erase(it) : std::next(it);
+            }
+        }
+        CHRONO_STOP
+        CHRONO_TIME
+
+        auto const blocksPerElement = static_cast<double>(testContainer.block_count()) / static_cast<double>(std::max<std::size_t>(testContainer.size(), 1));
+        std::cout << "\tblocks per element: " << blocksPerElement << '\n';
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(blocksPerElement);
+    }
+
+    auto handle = semilogx(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TBlockSize>
+void test_insertFillFactor(std::string_view containerName, LogSteps const& steps, float fillFactor)
+{
+    std::cout << "test: insert fill factor, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        gg::List<uint32_t, TBlockSize> testContainer{iterations, 0, fillFactor};
+
+        //An element is inserted every 4 elements over the whole container
+        CHRONO_START
+        for (auto it=testContainer.begin(); it!=testContainer.end();)
+        {
+            it = std::next(testContainer.insert(it, 1));
+            for (int a=0; a<4 && it!=testContainer.end(); ++a)
+            {
+                ++it;
+            }
+        }
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TContainer, bool TLocked>
+void test_concurrentPushBack(std::string_view containerName, std::vector<uint32_t> const& threadCounts, uint32_t iterations)
+{
+    std::cout << "test: concurrent pushBack, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const threadCount : threadCounts)
+    {
+        std::cout << "\tthreads: " << threadCount << " ";
+
+        TContainer testContainer{};
+        std::mutex mutex;
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        //The iterations are shared between the producers
+        CHRONO_START
+        for (uint32_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&](){
+                for (uint32_t i = 0; i < iterations/threadCount; ++i)
+                {
+                    if constexpr (TLocked)
+                    {
+                        std::scoped_lock const lock(mutex);
+                        testContainer.push_back(i);
+                    }
+                    else
+                    {
+                        testContainer.push_back(i);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(threadCount);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = plot(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+//Reference queue for the spsc benchmarks
+template<class T>
+class LockedDeque
+{
+public:
+    void push(T const& value)
+    {
+        std::scoped_lock const lock(this->_mutex);
+        this->_deque.push_back(value);
+    }
+    [[nodiscard]] bool try_pop(T& value)
+    {
+        std::scoped_lock const lock(this->_mutex);
+        if (this->_deque.empty())
+        {
+            return false;
+        }
+        value = this->_deque.front();
+        this->_deque.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<T> _deque;
+};
+
+template<class TQueue>
+void test_spscThroughput(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: spsc throughput, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        TQueue testQueue{};
+        uint32_t value = 0;
+
+        //One thread pushes every element while this one pops them
+        CHRONO_START
+        std::thread producer([&](){
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                testQueue.push(i);
+            }
+        });
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            while (!testQueue.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TQueue>
+void test_spscLatency(std::string_view containerName, LogSteps const& steps)
+{
+    std::cout << "test: spsc latency, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    for (auto const iterations : steps)
+    {
+        std::cout << "\titerations: " << iterations << " ";
+
+        TQueue pingQueue{};
+        TQueue pongQueue{};
+
+        //Every element makes a round trip between the two threads before the next one is sent
+        CHRONO_START
+        std::thread echo([&](){
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                while (!pingQueue.try_pop(value))
+                {
+                    std::this_thread::yield();
+                }
+                pongQueue.push(value);
+            }
+        });
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            pingQueue.push(i);
+            while (!pongQueue.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+        }
+        echo.join();
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(iterations);
+        resultY.emplace_back(time);
+    }
+
+    auto handle = semilogy(resultX, resultY);
+    handle->display_name(containerName);
+    handle->line_width(3.0f);
+    std::cout << "---" << std::endl;
+}
+template<class TBlockSize, class TAlgorithm>
+void test_parallelScaling(std::string_view containerName, std::vector<uint32_t> const& threadCounts, uint32_t size, TAlgorithm algorithm)
+{
+    std::cout << "test: parallel scaling, on " << containerName << std::endl;
+
+    std::vector<uint64_t> resultX;
+    std::vector<double> resultY;
+
+    gg::List<uint32_t, TBlockSize> testContainer(size, 1);
+
+    for (auto const threadCount : threadCounts)
+    {
+        std::cout << "\tthreads: " << threadCount << " ";
+
+        gg::par::ThreadPool pool{threadCount};
+
+        CHRONO_START
+        algorithm(pool, testContainer);
+        CHRONO_STOP
+        CHRONO_TIME
+
+        resultX.emplace_back(threadCount);
         resultY.emplace_back(time);
     }
 
-    auto handle = semilogy(resultX, resultY);
+    auto handle = plot(resultX, resultY);
     handle->display_name(containerName);
     handle->line_width(3.0f);
     std::cout << "---" << std::endl;
 }
-template<class TContainer>
-void test_iterations(std::string_view containerName, LogSteps const& steps)
+template<class TContainer, bool TSerial>
+void test_parallelLifetime(std::string_view containerName, std::vector<uint32_t> const& threadCounts, uint32_t size, typename TContainer::value_type const& value)
 {
-    std::cout << "test: iterations, on " << containerName << std::endl;
+    std::cout << "test: parallel construction and clear, on " << containerName << std::endl;
 
     std::vector<uint64_t> resultX;
     std::vector<double> resultY;
 
-    for (auto const iterations : steps)
+    for (auto const threadCount : threadCounts)
     {
-        std::cout << "\titerations: " << iterations << " ";
+        std::cout << "\tthreads: " << threadCount << " ";
 
-        TContainer testContainer{iterations};
+        gg::par::ThreadPool pool{threadCount};
 
         CHRONO_START
-        for (auto it=testContainer.begin(); it!=testContainer.end(); ++it) {}
+        if constexpr (TSerial)
+        {
+            TContainer testContainer(size, value);
+            testContainer.clear();
+        }
+        else
+        {
+            auto testContainer = gg::par::make_list<TContainer>(pool, size, value);
+            gg::par::clear(pool, testContainer);
+        }
         CHRONO_STOP
         CHRONO_TIME
 
-        resultX.emplace_back(iterations);
+        resultX.emplace_back(threadCount);
         resultY.emplace_back(time);
     }
 
-    auto handle = semilogy(resultX, resultY);
+    auto handle = plot(resultX, resultY);
     handle->display_name(containerName);
     handle->line_width(3.0f);
     std::cout << "---" << std::endl;
 }
-
 int main()
 {
     gg::List<int8_t, uint8_t> testList;
@@ -527,6 +989,9 @@ int main()
         test_insert<gg::List<std::string, uint32_t> >("gg::List<std::string uint32_t>", steps);
         test_insert<gg::List<std::string, uint64_t> >("gg::List<std::string uint64_t>", steps);
 
+        test_insert<gg::List<std::string, uint16_t, gg::InsertPolicies::SPLIT> >("gg::List<std::string uint16_t SPLIT>", steps);
+        test_insert<gg::List<std::string, uint64_t, gg::InsertPolicies::SPLIT> >("gg::List<std::string uint64_t SPLIT>", steps);
+
         save("test_insert_str.png");
     }
 
@@ -554,9 +1019,396 @@ int main()
         test_insert<gg::List<uint32_t, uint32_t> >("gg::List<uint32_t uint32_t>", steps);
         test_insert<gg::List<uint32_t, uint64_t> >("gg::List<uint32_t uint64_t>", steps);
 
+        test_insert<gg::List<uint32_t, uint16_t, gg::InsertPolicies::SPLIT> >("gg::List<uint32_t uint16_t SPLIT>", steps);
+        test_insert<gg::List<uint32_t, uint64_t, gg::InsertPolicies::SPLIT> >("gg::List<uint32_t uint64_t SPLIT>", steps);
+
         save("test_insert_int.png");
     }
 #endif
 
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: insert random str "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 6, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_insertRandom<std::list<std::string> >("std::list<std::string>", steps);
+
+        test_insertRandom<std::deque<std::string> >("std::deque<std::string>", steps);
+
+        test_insertRandom<gg::List<std::string, uint8_t> >("gg::List<std::string uint8_t>", steps);
+        test_insertRandom<gg::List<std::string, uint16_t> >("gg::List<std::string uint16_t>", steps);
+        test_insertRandom<gg::List<std::string, uint32_t> >("gg::List<std::string uint32_t>", steps);
+        test_insertRandom<gg::List<std::string, uint64_t> >("gg::List<std::string uint64_t>", steps);
+
+        save("test_insert_random_str.png");
+    }
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: insert random int "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 6, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_insertRandom<std::list<uint32_t> >("std::list<uint32_t>", steps);
+
+        test_insertRandom<std::deque<uint32_t> >("std::deque<uint32_t>", steps);
+
+        test_insertRandom<gg::List<uint32_t, uint8_t> >("gg::List<uint32_t uint8_t>", steps);
+        test_insertRandom<gg::List<uint32_t, uint16_t> >("gg::List<uint32_t uint16_t>", steps);
+        test_insertRandom<gg::List<uint32_t, uint32_t> >("gg::List<uint32_t uint32_t>", steps);
+        test_insertRandom<gg::List<uint32_t, uint64_t> >("gg::List<uint32_t uint64_t>", steps);
+
+        save("test_insert_random_int.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: sort str "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 7, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_sort<std::list<std::string> >("std::list<std::string>", steps);
+
+        test_sort<std::vector<std::string> >("std::vector<std::string>", steps);
+
+        test_sort<gg::List<std::string, uint8_t> >("gg::List<std::string uint8_t>", steps);
+        test_sort<gg::List<std::string, uint16_t> >("gg::List<std::string uint16_t>", steps);
+        test_sort<gg::List<std::string, uint32_t> >("gg::List<std::string uint32_t>", steps);
+        test_sort<gg::List<std::string, uint64_t> >("gg::List<std::string uint64_t>", steps);
+
+        save("test_sort_str.png");
+    }
+
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: sort int "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 7, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_sort<std::list<uint32_t> >("std::list<uint32_t>", steps);
+
+        test_sort<std::vector<uint32_t> >("std::vector<uint32_t>", steps);
+
+        test_sort<gg::List<uint32_t, uint8_t> >("gg::List<uint32_t uint8_t>", steps);
+        test_sort<gg::List<uint32_t, uint16_t> >("gg::List<uint32_t uint16_t>", steps);
+        test_sort<gg::List<uint32_t, uint32_t> >("gg::List<uint32_t uint32_t>", steps);
+        test_sort<gg::List<uint32_t, uint64_t> >("gg::List<uint32_t uint64_t>", steps);
+
+        save("test_sort_int.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: random erase blocks per element "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("blocks per element");
+
+        auto const steps = BuildLogStep(3, 6, 10);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_randomErase<uint8_t>("gg::List<uint32_t uint8_t> floor 0", steps, 0.0f);
+        test_randomErase<uint8_t>("gg::List<uint32_t uint8_t> floor 0.25", steps, 0.25f);
+        test_randomErase<uint8_t>("gg::List<uint32_t uint8_t> floor 0.5", steps, 0.5f);
+        test_randomErase<uint64_t>("gg::List<uint32_t uint64_t> floor 0", steps, 0.0f);
+        test_randomErase<uint64_t>("gg::List<uint32_t uint64_t> floor 0.25", steps, 0.25f);
+        test_randomErase<uint64_t>("gg::List<uint32_t uint64_t> floor 0.5", steps, 0.5f);
+
+        save("test_random_erase.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: insert after a fill factor load "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 7, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_insertFillFactor<uint16_t>("gg::List<uint32_t uint16_t> fill 1", steps, 1.0f);
+        test_insertFillFactor<uint16_t>("gg::List<uint32_t uint16_t> fill 0.9", steps, 0.9f);
+        test_insertFillFactor<uint16_t>("gg::List<uint32_t uint16_t> fill 0.75", steps, 0.75f);
+        test_insertFillFactor<uint16_t>("gg::List<uint32_t uint16_t> fill 0.5", steps, 0.5f);
+        test_insertFillFactor<uint64_t>("gg::List<uint32_t uint64_t> fill 1", steps, 1.0f);
+        test_insertFillFactor<uint64_t>("gg::List<uint32_t uint64_t> fill 0.9", steps, 0.9f);
+        test_insertFillFactor<uint64_t>("gg::List<uint32_t uint64_t> fill 0.75", steps, 0.75f);
+        test_insertFillFactor<uint64_t>("gg::List<uint32_t uint64_t> fill 0.5", steps, 0.5f);
+
+        save("test_insert_fill_factor.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: concurrent push back of 10M elements "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(2);
+        grid(true);
+        hold(true);
+        xlabel("threads");
+        ylabel("time s");
+
+        std::vector<uint32_t> threadCounts;
+        for (uint32_t i = 1; i <= std::max(4u, std::thread::hardware_concurrency()); i *= 2)
+        {
+            threadCounts.push_back(i);
+        }
+        xrange({1.0, static_cast<double>(threadCounts.back())});
+
+        test_concurrentPushBack<gg::List<uint32_t, uint16_t>, true>("std::mutex + gg::List<uint32_t uint16_t>", threadCounts, 10'000'000);
+        test_concurrentPushBack<gg::List<uint32_t, uint64_t>, true>("std::mutex + gg::List<uint32_t uint64_t>", threadCounts, 10'000'000);
+        test_concurrentPushBack<gg::ConcurrentAppendList<uint32_t, uint16_t>, false>("gg::ConcurrentAppendList<uint32_t uint16_t>", threadCounts, 10'000'000);
+        test_concurrentPushBack<gg::ConcurrentAppendList<uint32_t, uint64_t>, false>("gg::ConcurrentAppendList<uint32_t uint64_t>", threadCounts, 10'000'000);
+        test_concurrentPushBack<gg::ShardedList<uint32_t, uint16_t>, false>("gg::ShardedList<uint32_t uint16_t>", threadCounts, 10'000'000);
+        test_concurrentPushBack<gg::ShardedList<uint32_t, uint64_t>, false>("gg::ShardedList<uint32_t uint64_t>", threadCounts, 10'000'000);
+
+        save("test_concurrent_push_back.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: spsc queue throughput "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(4, 7, 10);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_spscThroughput<LockedDeque<uint32_t>>("std::mutex + std::deque<uint32_t>", steps);
+        test_spscThroughput<gg::SpscBlockQueue<uint32_t, uint16_t>>("gg::SpscBlockQueue<uint32_t uint16_t>", steps);
+        test_spscThroughput<gg::SpscBlockQueue<uint32_t, uint64_t>>("gg::SpscBlockQueue<uint32_t uint64_t>", steps);
+
+        save("test_spsc_throughput.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: spsc queue round trip latency "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(3);
+        grid(true);
+        hold(true);
+        xlabel("round trips");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(3, 5, 10);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_spscLatency<LockedDeque<uint32_t>>("std::mutex + std::deque<uint32_t>", steps);
+        test_spscLatency<gg::SpscBlockQueue<uint32_t, uint16_t>>("gg::SpscBlockQueue<uint32_t uint16_t>", steps);
+        test_spscLatency<gg::SpscBlockQueue<uint32_t, uint64_t>>("gg::SpscBlockQueue<uint32_t uint64_t>", steps);
+
+        save("test_spsc_latency.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: parallel algorithms on 10M elements "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(2);
+        grid(true);
+        hold(true);
+        xlabel("threads");
+        ylabel("time s");
+
+        std::vector<uint32_t> threadCounts;
+        for (uint32_t i = 1; i <= std::max(4u, std::thread::hardware_concurrency()); i *= 2)
+        {
+            threadCounts.push_back(i);
+        }
+        xrange({1.0, static_cast<double>(threadCounts.back())});
+
+        auto const forEach = [](auto& pool, auto& list){
+            gg::par::for_each(pool, list, [](uint32_t& value){value = value*3 + 1;});
+        };
+        auto const forEachHeavy = [](auto& pool, auto& list){
+            gg::par::for_each(pool, list, [](uint32_t& value){
+                double result = value;
+                for (int i = 0; i < 16; ++i)
+                {
+                    result = std::sqrt(result + i);
+                }
+                value = static_cast<uint32_t>(result);
+            });
+        };
+        auto const reduce = [](auto& pool, auto& list){
+            std::cout << "(" << gg::par::reduce(pool, list, uint64_t{0}) << ") ";
+        };
+        auto const countIf = [](auto& pool, auto& list){
+            std::cout << "(" << gg::par::count_if(pool, list, [](uint32_t value){return value%3 == 1;}) << ") ";
+        };
+        auto const findIf = [](auto& pool, auto& list){
+            std::cout << "(" << (gg::par::find_if(pool, list, [](uint32_t value){return value == 0;}) == list.end()) << ") ";
+        };
+
+        test_parallelScaling<uint16_t>("for_each gg::List<uint32_t uint16_t>", threadCounts, 10'000'000, forEach);
+        test_parallelScaling<uint64_t>("for_each gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, forEach);
+        test_parallelScaling<uint16_t>("for_each 16 sqrt gg::List<uint32_t uint16_t>", threadCounts, 10'000'000, forEachHeavy);
+        test_parallelScaling<uint64_t>("for_each 16 sqrt gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, forEachHeavy);
+        test_parallelScaling<uint16_t>("reduce gg::List<uint32_t uint16_t>", threadCounts, 10'000'000, reduce);
+        test_parallelScaling<uint64_t>("reduce gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, reduce);
+        test_parallelScaling<uint16_t>("count_if gg::List<uint32_t uint16_t>", threadCounts, 10'000'000, countIf);
+        test_parallelScaling<uint64_t>("count_if gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, countIf);
+        test_parallelScaling<uint16_t>("find_if (no match) gg::List<uint32_t uint16_t>", threadCounts, 10'000'000, findIf);
+        test_parallelScaling<uint64_t>("find_if (no match) gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, findIf);
+
+        save("test_parallel_scaling.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: construction and clear of 10M elements "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(2);
+        grid(true);
+        hold(true);
+        xlabel("threads");
+        ylabel("time s");
+
+        std::vector<uint32_t> threadCounts;
+        for (uint32_t i = 1; i <= std::max(4u, std::thread::hardware_concurrency()); i *= 2)
+        {
+            threadCounts.push_back(i);
+        }
+        xrange({1.0, static_cast<double>(threadCounts.back())});
+
+        std::string const text(30, 'x');
+
+        test_parallelLifetime<gg::List<uint32_t, uint64_t>, true>("List(n, v) + clear() gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, 1);
+        test_parallelLifetime<gg::List<uint32_t, uint64_t>, false>("par::make_list + par::clear gg::List<uint32_t uint64_t>", threadCounts, 10'000'000, 1);
+        test_parallelLifetime<gg::List<std::string, uint64_t>, true>("List(n, v) + clear() gg::List<std::string uint64_t>", threadCounts, 10'000'000, text);
+        test_parallelLifetime<gg::List<std::string, uint64_t>, false>("par::make_list + par::clear gg::List<std::string uint64_t>", threadCounts, 10'000'000, text);
+
+        save("test_parallel_lifetime.png");
+    }
+#endif
+
+#if 1
+    {
+        figure()->size(FIG_SIZE_W, FIG_SIZE_H);
+        title("test: destruction on the calling thread "+mode);
+        auto cfgLegend = legend({});
+        cfgLegend->box(false);
+        cfgLegend->horizontal_location(legend::horizontal_alignment::left);
+        cfgLegend->vertical_location(legend::vertical_alignment::top);
+        cfgLegend->font_size(8);
+        cfgLegend->num_columns(2);
+        grid(true);
+        hold(true);
+        xlabel("iteration");
+        ylabel("time s");
+
+        auto const steps = BuildLogStep(5, 8, 20);
+        xrange({static_cast<double>(steps.front()), static_cast<double>(steps.back())});
+
+        test_destruction<gg::List<std::string, uint16_t> >("~List gg::List<std::string uint16_t>", steps);
+        test_destruction<gg::List<std::string, uint64_t> >("~List gg::List<std::string uint64_t>", steps);
+        test_releaseAsync<gg::List<std::string, uint16_t> >("release_async gg::List<std::string uint16_t>", steps);
+        test_releaseAsync<gg::List<std::string, uint64_t> >("release_async gg::List<std::string uint64_t>", steps);
+
+        save("test_release_async.png");
+    }
+#endif
+
     return 0;
 }
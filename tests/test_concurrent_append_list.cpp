@@ -0,0 +1,154 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "C_concurrentAppendList.hpp"
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <atomic>
+
+TEST_CASE("testing concurrent append list")
+{
+    SUBCASE("single thread")
+    {
+        gg::ConcurrentAppendList<int, uint8_t> list;
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+        CHECK(list.begin() == list.end());
+
+        for (int i=0; i<20; ++i)
+        {
+            list.push_back(i);
+        }
+        CHECK(list.size() == 20);
+        CHECK(list.block_count() == 3);
+
+        int expected = 0;
+        for (auto const value : list)
+        {
+            CHECK(value == expected++);
+        }
+        CHECK(expected == 20);
+    }
+
+    SUBCASE("emplace and move")
+    {
+        gg::ConcurrentAppendList<std::string, uint8_t> list;
+        for (int i=0; i<20; ++i)
+        {
+            CHECK(list.emplace_back(30, static_cast<char>('a'+i)) == std::string(30, static_cast<char>('a'+i)));
+        }
+
+        gg::ConcurrentAppendList<std::string, uint8_t> other{std::move(list)};
+        CHECK(other.size() == 20);
+        CHECK(list.size() == 0);
+        CHECK(other.begin()->size() == 30);
+
+        list = std::move(other);
+        CHECK(list.size() == 20);
+        CHECK(*std::next(list.begin(), 19) == std::string(30, 't'));
+    }
+
+    SUBCASE("multiple producers")
+    {
+        constexpr int threadCount = 4;
+        constexpr int perThread = 20000;
+
+        gg::ConcurrentAppendList<int, uint16_t> list;
+        std::vector<std::thread> threads;
+        for (int t=0; t<threadCount; ++t)
+        {
+            threads.emplace_back([&list, t](){
+                for (int i=0; i<perThread; ++i)
+                {
+                    list.push_back(t*perThread + i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(list.size() == threadCount*perThread);
+
+        //Every value is present once and the values of a producer keep their order
+        std::vector<int> values(list.begin(), list.end());
+        std::vector<int> lastValues(threadCount, -1);
+        bool ordered = true;
+        for (auto const value : values)
+        {
+            ordered = ordered && value > lastValues[value/perThread];
+            lastValues[value/perThread] = value;
+        }
+        CHECK(ordered);
+
+        std::sort(values.begin(), values.end());
+        bool unique = true;
+        for (int i=0; i<threadCount*perThread; ++i)
+        {
+            unique = unique && values[i] == i;
+        }
+        CHECK(unique);
+    }
+
+    SUBCASE("readers during appends")
+    {
+        constexpr int threadCount = 3;
+        constexpr int perThread = 20000;
+
+        gg::ConcurrentAppendList<std::string, uint32_t> list;
+        std::atomic<int> producing{threadCount};
+        std::vector<std::thread> threads;
+        for (int t=0; t<threadCount; ++t)
+        {
+            threads.emplace_back([&](){
+                for (int i=0; i<perThread; ++i)
+                {
+                    list.emplace_back(40, 'x');
+                }
+                --producing;
+            });
+        }
+
+        //A reader only ever sees fully constructed elements
+        bool valid = true;
+        std::size_t lastSize = 0;
+        bool growing = true;
+        while (producing.load() > 0)
+        {
+            std::size_t count = 0;
+            for (auto const& value : list)
+            {
+                valid = valid && value.size() == 40 && value.front() == 'x';
+                ++count;
+            }
+            growing = growing && count >= lastSize;
+            lastSize = count;
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(valid);
+        CHECK(growing);
+        CHECK(list.size() == threadCount*perThread);
+    }
+}
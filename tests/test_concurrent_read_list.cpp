@@ -0,0 +1,203 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "C_concurrentReadList.hpp"
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+
+namespace
+{
+
+struct LiveCounter
+{
+    LiveCounter(int value) : _value(value) {++gLiveCount;}
+    LiveCounter(LiveCounter const& r) : _value(r._value) {++gLiveCount;}
+    ~LiveCounter() {--gLiveCount;}
+
+    int _value;
+    inline static int gLiveCount = 0;
+};
+
+}//end
+
+TEST_CASE("testing concurrent read list")
+{
+    SUBCASE("single thread")
+    {
+        gg::ConcurrentReadList<int, uint8_t> list;
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        for (int i=0; i<20; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i=1; i<=10; ++i)
+        {
+            list.push_front(-i);
+        }
+        CHECK(list.size() == 30);
+
+        int expected = -10;
+        for (auto const value : list)
+        {
+            CHECK(value == expected++);
+        }
+        CHECK(expected == 20);
+
+        //Without readers, collecting reclaims everything retired
+        CHECK(list.remove_if([](int value){return value%2 != 0;}) == 15);
+        CHECK(list.size() == 15);
+        list.collect();
+        CHECK(list.retired_count() == 0);
+
+        expected = -10;
+        for (auto const value : list)
+        {
+            CHECK(value == expected);
+            expected += 2;
+        }
+
+        //The erased places at the back are reused once reclaimed
+        auto const blocks = list.block_count();
+        list.push_back(100);
+        CHECK(list.block_count() == blocks);
+    }
+
+    SUBCASE("erase until empty and refill")
+    {
+        gg::ConcurrentReadList<int, uint8_t> list;
+        for (int round=0; round<3; ++round)
+        {
+            for (int i=0; i<40; ++i)
+            {
+                list.push_back(i);
+            }
+            for (auto it=list.begin(); it!=list.end();)
+            {
+                it = list.erase(it);
+            }
+            CHECK(list.empty());
+            CHECK(list.begin() == list.end());
+            CHECK(list.block_count() == 1);
+        }
+        list.push_front(1);
+        list.push_back(2);
+        CHECK(list.size() == 2);
+        CHECK(*list.begin() == 1);
+    }
+
+    SUBCASE("reclamation waits for readers")
+    {
+        {
+            gg::ConcurrentReadList<LiveCounter, uint8_t> list;
+            for (int i=0; i<20; ++i)
+            {
+                list.emplace_back(i);
+            }
+
+            {
+                auto const guard = list.read();
+                auto it = guard.begin();
+                CHECK(it->_value == 0);
+
+                //The element stays alive for the reader while it is erased
+                list.erase(list.begin());
+                list.collect();
+                CHECK(list.retired_count() == 1);
+                CHECK(it->_value == 0);
+                CHECK(LiveCounter::gLiveCount == 20);
+
+                list.clear();
+                list.collect();
+                CHECK(list.size() == 0);
+                CHECK(LiveCounter::gLiveCount == 20);
+
+                //The reader still sees the old chain
+                int count = 0;
+                for (; it!=guard.end(); ++it)
+                {
+                    ++count;
+                }
+                CHECK(count == 20);
+            }
+
+            list.collect();
+            CHECK(list.retired_count() == 0);
+            CHECK(LiveCounter::gLiveCount == 0);
+
+            list.emplace_back(7);
+            list.emplace_front(6);
+            CHECK(LiveCounter::gLiveCount == 2);
+        }
+        CHECK(LiveCounter::gLiveCount == 0);
+    }
+
+    SUBCASE("readers during writes")
+    {
+        constexpr int readerCount = 3;
+        constexpr int rounds = 200;
+
+        gg::ConcurrentReadList<std::string, uint16_t> list;
+        std::atomic<bool> writing{true};
+        std::atomic<bool> valid{true};
+        std::vector<std::thread> readers;
+        for (int t=0; t<readerCount; ++t)
+        {
+            readers.emplace_back([&](){
+                while (writing.load())
+                {
+                    auto const guard = list.read();
+                    for (auto const& value : guard)
+                    {
+                        if (value.size() != 40 || value.front() != 'x')
+                        {
+                            valid = false;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (int round=0; round<rounds; ++round)
+        {
+            for (int i=0; i<100; ++i)
+            {
+                list.emplace_back(40, 'x');
+                list.emplace_front(40, 'x');
+            }
+            int index = 0;
+            list.remove_if([&](std::string const&){return index++ % 3 != 0;});
+            if (round % 50 == 49)
+            {
+                list.clear();
+            }
+        }
+        writing = false;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        CHECK(valid.load());
+        list.collect();
+        CHECK(list.retired_count() == 0);
+    }
+}
@@ -18,6 +18,30 @@
 #include "C_list.hpp"
 #include <vector>
 #include <string>
+#include <algorithm>
+
+namespace
+{
+
+struct LiveCounter
+{
+    inline static int gLiveCount = 0;
+
+    LiveCounter() { ++gLiveCount; }
+    LiveCounter(LiveCounter const&) { ++gLiveCount; }
+    LiveCounter(LiveCounter&&) noexcept { ++gLiveCount; }
+    ~LiveCounter() { --gLiveCount; }
+};
+
+//Can be copy constructed but not assigned
+struct ConstMember
+{
+    explicit ConstMember(int value) : _value(value) {}
+
+    int const _value;
+};
+
+}//end
 
 TEST_CASE("testing list constructors")
 {
@@ -306,6 +330,32 @@ TEST_CASE("testing list assignment operators")
         }
     }
 
+    SUBCASE("copy assignment of elements that can't be assigned")
+    {
+        gg::List<ConstMember, uint8_t> source;
+        for (int i = 0; i < 20; ++i)
+        {
+            source.push_back(ConstMember{i});
+        }
+        gg::List<ConstMember, uint8_t> target;
+        for (int i = 0; i < 30; ++i)
+        {
+            target.push_back(ConstMember{-i});
+        }
+
+        target = source;
+        CHECK(target.size() == 20);
+        int expected = 0;
+        for (auto const& element : target)
+        {
+            CHECK(element._value == expected++);
+        }
+
+        target.assign(25, ConstMember{7});
+        CHECK(target.size() == 25);
+        CHECK(std::all_of(target.begin(), target.end(), [](ConstMember const& element){ return element._value == 7; }));
+    }
+
     SUBCASE("move assignment with empty source")
     {
         gg::List<int> source;  // empty
@@ -349,6 +399,32 @@ TEST_CASE("testing list assignment operators")
     }
 }
 
+TEST_CASE("testing settings follow copies and moves")
+{
+    gg::List<int, uint8_t> source;
+    source.push_back(1);
+    source.set_erase_compaction(5);
+    source.set_density_floor(0.25f);
+
+    gg::List<int, uint8_t> copied{source};
+    CHECK(copied.get_erase_compaction() == 5);
+    CHECK(copied.get_density_floor() == doctest::Approx(0.25f));
+
+    gg::List<int, uint8_t> copyAssigned;
+    copyAssigned = source;
+    CHECK(copyAssigned.get_erase_compaction() == 5);
+    CHECK(copyAssigned.get_density_floor() == doctest::Approx(0.25f));
+
+    gg::List<int, uint8_t> moveAssigned;
+    moveAssigned = gg::List<int, uint8_t>{source};
+    CHECK(moveAssigned.get_erase_compaction() == 5);
+    CHECK(moveAssigned.get_density_floor() == doctest::Approx(0.25f));
+
+    gg::List<int, uint8_t> moved{std::move(source)};
+    CHECK(moved.get_erase_compaction() == 5);
+    CHECK(moved.get_density_floor() == doctest::Approx(0.25f));
+}
+
 TEST_CASE("testing clear method")
 {
     SUBCASE("clear non-empty list")
@@ -405,4 +481,39 @@ TEST_CASE("testing clear method")
         ++it;
         CHECK(*it == 20);
     }
-}
\ No newline at end of file
+
+    SUBCASE("clear and destruction destroy every element once")
+    {
+        {
+            gg::List<LiveCounter, uint8_t> list(1000);
+            CHECK(LiveCounter::gLiveCount == 1000);
+
+            for (int i=0; i<500; ++i)
+            {//Leave holes so that destruction walks sparse blocks
+                list.erase(std::next(list.begin(), i));
+            }
+            CHECK(LiveCounter::gLiveCount == 500);
+
+            list.clear();
+            CHECK(LiveCounter::gLiveCount == 0);
+            CHECK(list.block_count() == 1);
+
+            list.resize(300);
+            CHECK(LiveCounter::gLiveCount == 300);
+        }
+        CHECK(LiveCounter::gLiveCount == 0);
+    }
+
+    SUBCASE("clear a moved from list")
+    {
+        gg::List<std::string> list(100, "abc");
+        gg::List<std::string> other(std::move(list));
+        list = std::move(other);
+        other.clear();
+
+        CHECK(other.empty());
+        other.push_back("def");
+        CHECK(other.front() == "def");
+        CHECK(list.size() == 100);
+    }
+}
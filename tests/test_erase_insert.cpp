@@ -18,6 +18,32 @@
 #include "C_list.hpp"
 #include <string>
 #include <vector>
+#include <list>
+#include <random>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+
+namespace
+{
+
+//Owns a resource and counts the live instances, relocating it with a memcpy is fine
+struct RelocatableHandle
+{
+    explicit RelocatableHandle(int value) : _value(new int(value)) { ++gLiveCount; }
+    RelocatableHandle(RelocatableHandle const& r) : _value(new int(*r._value)) { ++gLiveCount; }
+    RelocatableHandle(RelocatableHandle&& r) noexcept : _value(r._value) { r._value = nullptr; ++gLiveCount; }
+    RelocatableHandle& operator=(RelocatableHandle const& r) { *this->_value = *r._value; return *this; }
+    ~RelocatableHandle() { delete this->_value; --gLiveCount; }
+
+    int* _value;
+    inline static int gLiveCount = 0;
+};
+
+}//end
+
+template<>
+struct gg::is_trivially_relocatable<RelocatableHandle> : std::true_type {};
 
 TEST_CASE("testing erase operations")
 {
@@ -685,4 +711,620 @@ TEST_CASE("testing edge cases for erase and insert")
             ++expectedIt;
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("testing range erase")
+{
+    SUBCASE("erase range spanning several blocks")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+
+        auto first = list.begin();
+        for (int i = 0; i < 5; ++i) { ++first; }
+        auto last = first;
+        for (int i = 0; i < 90; ++i) { ++last; }
+
+        auto it = list.erase(first, last);
+
+        CHECK(list.size() == 10);
+        CHECK(*it == 95);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2, 3, 4, 95, 96, 97, 98, 99});
+    }
+
+    SUBCASE("erase range up to the end")
+    {
+        gg::List<std::string> list;
+        for (int i = 0; i < 50; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+
+        auto first = list.begin();
+        for (int i = 0; i < 20; ++i) { ++first; }
+
+        auto it = list.erase(first, list.end());
+
+        CHECK(list.size() == 20);
+        CHECK(it == list.end());
+        CHECK(list.back() == "19");
+
+        list.push_back("last");
+        CHECK(list.back() == "last");
+        CHECK(list.size() == 21);
+    }
+
+    SUBCASE("erase whole list")
+    {
+        gg::List<int> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_front(i);
+        }
+
+        auto it = list.erase(list.begin(), list.end());
+
+        CHECK(list.empty());
+        CHECK(it == list.end());
+        CHECK(list.begin() == list.end());
+
+        list.push_back(1);
+        list.push_front(0);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1});
+    }
+
+    SUBCASE("erase empty range")
+    {
+        gg::List<int> list;
+        list.push_back(1);
+        list.push_back(2);
+
+        auto it = list.erase(list.begin(), list.begin());
+
+        CHECK(list.size() == 2);
+        CHECK(*it == 1);
+    }
+
+    SUBCASE("erase range destroys every element once")
+    {
+        struct Counted
+        {
+            explicit Counted(int* counter) : _counter(counter) {}
+            Counted(Counted const& r) : _counter(r._counter) {}
+            ~Counted() { ++(*_counter); }
+            int* _counter;
+        };
+
+        int destroyed = 0;
+        {
+            gg::List<Counted, uint8_t> list;
+            for (int i = 0; i < 40; ++i)
+            {
+                list.emplace_back(&destroyed);
+            }
+
+            auto first = ++list.begin();
+            auto last = --list.end();
+            list.erase(first, last);
+
+            CHECK(destroyed == 38);
+            CHECK(list.size() == 2);
+        }
+        CHECK(destroyed == 40);
+    }
+}
+
+TEST_CASE("testing insert at random positions")
+{
+    SUBCASE("inserting keeps the order and the front/back caches")
+    {
+        gg::List<int, uint8_t> list;
+        std::list<int> expected;
+        std::mt19937 random{3};
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            auto const index = random() % (expected.size() + 1);
+            auto const it = list.insert(std::next(list.cbegin(), static_cast<long>(index)), i);
+            expected.insert(std::next(expected.begin(), static_cast<long>(index)), i);
+            CHECK(*it == i);
+
+            if (i % 100 == 0)
+            {
+                list.push_front(-i);
+                expected.push_front(-i);
+                list.push_back(-i);
+                expected.push_back(-i);
+            }
+        }
+
+        CHECK(list.size() == expected.size());
+        CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    }
+
+    SUBCASE("inserting at the same place fills the nearest holes")
+    {
+        gg::List<std::string, uint8_t> list;
+        for (int i = 0; i < 32; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+        list.remove_if([](std::string const& value){ return std::stoi(value) % 2 == 0; });
+        auto const blocks = list.block_count();
+
+        auto it = std::next(list.begin(), 8);
+        for (int i = 0; i < 12; ++i)
+        {
+            it = std::next(list.insert(it, "new"));
+        }
+
+        CHECK(list.size() == 28);
+        CHECK(*it == "17");
+        CHECK(list.block_count() == blocks);
+    }
+}
+
+TEST_CASE("testing split insert policy")
+{
+    SUBCASE("inserting keeps the order and the front/back caches")
+    {
+        gg::List<int, uint8_t, gg::InsertPolicies::SPLIT> list;
+        std::list<int> expected;
+        std::mt19937 random{5};
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            auto const index = random() % (expected.size() + 1);
+            auto const it = list.insert(std::next(list.cbegin(), static_cast<long>(index)), i);
+            expected.insert(std::next(expected.begin(), static_cast<long>(index)), i);
+            CHECK(*it == i);
+
+            if (i % 100 == 0)
+            {
+                list.push_front(-i);
+                expected.push_front(-i);
+                list.push_back(-i);
+                expected.push_back(-i);
+            }
+        }
+
+        CHECK(list.size() == expected.size());
+        CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    }
+
+    SUBCASE("a full block is split in two halves")
+    {
+        gg::List<std::string, uint8_t, gg::InsertPolicies::SPLIT> list;
+        for (int i = 0; i < 4; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            list.push_front(std::to_string(-i-1));
+        }
+        REQUIRE(list.block_count() == 1);
+
+        auto it = std::next(list.begin(), 2);
+        it = list.insert(it, "split");
+        CHECK(list.block_count() == 2);
+        CHECK(*std::next(it) == "-2");
+
+        //The gap is right before the position, the next inserts don't move anything
+        std::string const* address = &*std::next(it);
+        for (int i = 0; i < 3; ++i)
+        {
+            it = list.insert(it, "gap");
+        }
+        CHECK(&*std::next(it, 4) == address);
+        CHECK(list.block_count() == 2);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) ==
+              std::vector<std::string>{"-4", "-3", "gap", "gap", "gap", "split", "-2", "-1", "0", "1", "2", "3"});
+    }
+
+    SUBCASE("a block that is not full only uses its own holes")
+    {
+        gg::List<int, uint8_t, gg::InsertPolicies::SPLIT> list;
+        for (int i = 0; i < 12; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 0; i < 12; ++i)
+        {
+            list.push_front(-i-1);
+        }
+        REQUIRE(list.block_count() == 3);
+
+        //Free the last place of the first block and of the middle block
+        list.erase(std::next(list.begin(), 7));
+        list.erase(std::next(list.begin(), 14));
+        auto const blocks = list.block_count();
+
+        //Moving "-4" to the previous block would be cheaper but the neighbours are left untouched
+        int const* address = &*std::next(list.begin(), 7);
+        REQUIRE(*address == -4);
+        auto const it = list.insert(std::next(list.begin(), 8), 100);
+        CHECK(*it == 100);
+        CHECK(&*std::next(list.begin(), 7) == address);
+        CHECK(list.block_count() == blocks);
+        CHECK(std::vector<int>(list.begin(), list.end()) ==
+              std::vector<int>{-12, -11, -10, -9, -8, -7, -6, -4, 100, -3, -2, -1, 0, 1, 2,
+                               4, 5, 6, 7, 8, 9, 10, 11});
+    }
+}
+
+TEST_CASE("testing trivially relocatable elements")
+{
+    static_assert(gg::is_trivially_relocatable_v<int>);
+    static_assert(gg::is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(gg::is_trivially_relocatable_v<RelocatableHandle>);
+    static_assert(!gg::is_trivially_relocatable_v<std::string>);
+
+    SUBCASE("unique_ptr elements survive shifts, splits and compaction")
+    {
+        gg::List<std::unique_ptr<int>, uint8_t> list;
+        std::list<int> expected;
+        std::mt19937 random{11};
+
+        for (int i = 0; i < 500; ++i)
+        {
+            auto const index = random() % (expected.size() + 1);
+            list.insert(std::next(list.cbegin(), static_cast<long>(index)), std::make_unique<int>(i));
+            expected.insert(std::next(expected.begin(), static_cast<long>(index)), i);
+        }
+        list.remove_if([](std::unique_ptr<int> const& value){ return *value % 3 == 0; });
+        expected.remove_if([](int value){ return value % 3 == 0; });
+        list.compact();
+
+        CHECK(list.size() == expected.size());
+        auto it = expected.begin();
+        for (auto const& value : list)
+        {
+            CHECK(*value == *it++);
+        }
+    }
+
+    SUBCASE("specialized types are never destroyed twice")
+    {
+        {
+            gg::List<RelocatableHandle, uint8_t, gg::InsertPolicies::SPLIT> list;
+            for (int i = 0; i < 200; ++i)
+            {
+                list.insert(std::next(list.cbegin(), static_cast<long>(list.size() / 2)), RelocatableHandle{i});
+            }
+            CHECK(RelocatableHandle::gLiveCount == 200);
+
+            list.reverse();
+            list.erase(std::next(list.begin(), 10), std::next(list.begin(), 150));
+            list.compact();
+            CHECK(RelocatableHandle::gLiveCount == 60);
+            CHECK(list.size() == 60);
+        }
+        CHECK(RelocatableHandle::gLiveCount == 0);
+    }
+}
+
+TEST_CASE("testing insert cursor")
+{
+    SUBCASE("inserting through a cursor keeps the order")
+    {
+        for (std::size_t start : {0, 1, 7, 50, 100})
+        {
+            gg::List<std::string, uint8_t> list;
+            std::list<std::string> expected;
+            for (int i = 0; i < 100; ++i)
+            {
+                list.push_back(std::to_string(i));
+                expected.push_back(std::to_string(i));
+            }
+
+            auto expectedIt = std::next(expected.begin(), static_cast<long>(start));
+            {
+                auto cursor = list.cursor(std::next(list.cbegin(), static_cast<long>(start)));
+                for (int i = 0; i < 300; ++i)
+                {
+                    auto const it = cursor.insert("c" + std::to_string(i));
+                    expected.insert(expectedIt, "c" + std::to_string(i));
+                    CHECK(*it == "c" + std::to_string(i));
+                }
+                CHECK(cursor.position() == (start == 100 ? list.end() : std::next(list.begin(), static_cast<long>(start + 300))));
+            }
+
+            CHECK(list.size() == expected.size());
+            CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+            list.push_front("front");
+            expected.push_front("front");
+            list.push_back("back");
+            expected.push_back("back");
+            CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    SUBCASE("the gap is filled without moving the elements after the cursor")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 64; ++i)
+        {
+            list.push_back(i);
+        }
+        auto const blocks = list.block_count();
+
+        auto cursor = list.cursor(std::next(list.cbegin(), 30));
+        cursor.insert(-1);
+        int const* address = &*cursor.position();
+        for (int i = 0; i < 79; ++i)
+        {
+            cursor.insert(-1);
+        }
+        CHECK(&*cursor.position() == address);
+        CHECK(*cursor.position() == 30);
+        //One split leaving 6 free places, then only whole blocks of inserted elements
+        CHECK(list.block_count() == blocks + 1 + (80-6+7)/8);
+
+        cursor.release();
+        CHECK(*cursor.position() == 30);
+        CHECK(list.size() == 144);
+        CHECK(std::count(list.begin(), list.end(), -1) == 80);
+        CHECK(*std::next(list.begin(), 110) == 30);
+
+        //The cursor can still be used after a release
+        cursor.insert(-2);
+        CHECK(*std::next(list.begin(), 110) == -2);
+        CHECK(*std::next(list.begin(), 111) == 30);
+    }
+
+    SUBCASE("releasing a gap in the block of the cursor doesn't merge anything")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 16; ++i)
+        {
+            list.push_back(i);
+        }
+        //A sparse previous block, and free places before 7 in its own block
+        list.remove_if([](int value){ return value == 1 || value == 2 || value == 3 || value == 5 || value == 6; });
+        auto const blocks = list.block_count();
+        int const* first = &list.front();
+        int const* four = &*std::next(list.begin());
+
+        auto cursor = list.cursor(std::find(list.cbegin(), list.cend(), 7));
+        int const* address = &*cursor.position();
+        cursor.insert(-1);
+        cursor.release();
+
+        CHECK(list.block_count() == blocks);
+        CHECK(&list.front() == first);
+        CHECK(&*std::next(list.begin()) == four);
+        CHECK(&*cursor.position() == address);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 4, -1, 7, 8, 9, 10, 11, 12, 13, 14, 15});
+    }
+
+    SUBCASE("a cursor on an empty list")
+    {
+        gg::List<int, uint8_t> list;
+        auto cursor = list.cursor(list.cbegin());
+        for (int i = 0; i < 20; ++i)
+        {
+            cursor.insert(i);
+        }
+        CHECK(list.size() == 20);
+        CHECK(list.front() == 0);
+        CHECK(list.back() == 19);
+    }
+}
+
+TEST_CASE("testing batched insert")
+{
+    SUBCASE("inserting many positions in list order")
+    {
+        for (int seed = 0; seed < 20; ++seed)
+        {
+            std::mt19937 random{static_cast<unsigned>(seed)};
+            gg::List<std::string, uint8_t> list;
+            std::vector<std::string> expected;
+            auto const size = random() % 100;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                list.push_back(std::to_string(i));
+                expected.push_back(std::to_string(i));
+            }
+            for (auto it = list.begin(); it != list.end();)
+            {//Leave some holes
+                it = random() % 4 == 0 ? list.erase(it) : std::next(it);
+            }
+            expected.assign(list.begin(), list.end());
+
+            //Sorted indexes, some of them repeated and some at the end
+            std::vector<std::size_t> indexes;
+            auto const count = random() % 200;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                indexes.push_back(random() % (expected.size() + 1));
+            }
+            std::sort(indexes.begin(), indexes.end());
+
+            std::vector<std::pair<gg::List<std::string, uint8_t>::const_iterator, std::string>> inserts;
+            std::vector<std::string> merged;
+            std::size_t index = 0;
+            for (std::size_t i = 0; i < indexes.size(); ++i)
+            {
+                for (; index < indexes[i]; ++index)
+                {
+                    merged.push_back(expected[index]);
+                }
+                inserts.emplace_back(std::next(list.cbegin(), static_cast<long>(indexes[i])), "new" + std::to_string(i));
+                merged.push_back("new" + std::to_string(i));
+            }
+            for (; index < expected.size(); ++index)
+            {
+                merged.push_back(expected[index]);
+            }
+
+            auto const result = list.insert_many(inserts.begin(), inserts.end());
+            REQUIRE(result.size() == inserts.size());
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK(*result[i] == "new" + std::to_string(i));
+            }
+            CHECK(list.size() == merged.size());
+            CHECK(std::vector<std::string>(list.begin(), list.end()) == merged);
+
+            list.push_front("front");
+            list.push_back("back");
+            CHECK(list.front() == "front");
+            CHECK(list.back() == "back");
+        }
+    }
+
+    SUBCASE("elements after the inserted blocks don't move")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 32; ++i)
+        {
+            list.push_back(i);
+        }
+        int const* address = &*std::next(list.begin(), 20);
+        auto const blocks = list.block_count();
+
+        std::vector<std::pair<gg::List<int, uint8_t>::const_iterator, int>> inserts;
+        for (int i = 0; i < 10; ++i)
+        {
+            inserts.emplace_back(std::next(list.cbegin(), 5), -i);
+        }
+        list.insert_many(inserts.begin(), inserts.end());
+
+        CHECK(&*std::next(list.begin(), 30) == address);
+        CHECK(list.block_count() == blocks + 2);
+        CHECK(*std::next(list.begin(), 4) == 4);
+        CHECK(*std::next(list.begin(), 5) == 0);
+        CHECK(*std::next(list.begin(), 14) == -9);
+        CHECK(*std::next(list.begin(), 15) == 5);
+    }
+
+    SUBCASE("holes of the neighbour blocks are used before allocating")
+    {
+        for (std::size_t count : {3, 6})
+        {
+            gg::List<int, uint8_t> list(24);
+            std::iota(list.begin(), list.end(), 0);
+            for (int value : {9, 10, 11, 20, 21, 22})
+            {//Free the tail of the block before 12 and the head of the block after 19
+                list.erase(std::find(list.begin(), list.end(), value));
+            }
+            auto const blocks = list.block_count();
+
+            std::vector<int> expected(list.begin(), list.end());
+            std::vector<std::pair<gg::List<int, uint8_t>::const_iterator, int>> inserts;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                inserts.emplace_back(std::next(list.cbegin(), 9 + static_cast<long>(i)), -static_cast<int>(i));
+                expected.insert(expected.begin() + 9 + 2*static_cast<long>(i), -static_cast<int>(i));
+            }
+            list.insert_many(inserts.begin(), inserts.end());
+
+            CHECK(list.block_count() == blocks);
+            CHECK(std::vector<int>(list.begin(), list.end()) == expected);
+        }
+    }
+
+    SUBCASE("values are moved from move iterators")
+    {
+        gg::List<std::unique_ptr<int>, uint8_t> list;
+        for (int i = 0; i < 20; ++i)
+        {
+            list.push_back(std::make_unique<int>(i));
+        }
+
+        std::vector<std::pair<gg::List<std::unique_ptr<int>, uint8_t>::const_iterator, std::unique_ptr<int>>> inserts;
+        inserts.emplace_back(std::next(list.cbegin(), 3), std::make_unique<int>(-1));
+        inserts.emplace_back(list.cend(), std::make_unique<int>(-2));
+        auto const result = list.insert_many(std::make_move_iterator(inserts.begin()), std::make_move_iterator(inserts.end()));
+
+        CHECK(inserts[0].second == nullptr);
+        CHECK(**result[0] == -1);
+        CHECK(**result[1] == -2);
+        CHECK(*list.back() == -2);
+        CHECK(list.size() == 22);
+    }
+}
+
+TEST_CASE("testing batched erase")
+{
+    SUBCASE("erasing positions in any order")
+    {
+        for (int seed = 0; seed < 20; ++seed)
+        {
+            std::mt19937 random{static_cast<unsigned>(seed)};
+            gg::List<std::string, uint8_t> list;
+            std::list<std::string> expected;
+            auto const size = random() % 200;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                list.push_back(std::to_string(i));
+                expected.push_back(std::to_string(i));
+            }
+
+            std::vector<gg::List<std::string, uint8_t>::const_iterator> positions;
+            for (auto it = list.cbegin(); it != list.cend(); ++it)
+            {
+                if (random() % 3 == 0)
+                {
+                    positions.push_back(it);
+                    expected.remove(*it);
+                }
+            }
+            if (!positions.empty())
+            {//Duplicates and the end are ignored
+                positions.push_back(positions.front());
+            }
+            positions.push_back(list.cend());
+            std::shuffle(positions.begin(), positions.end(), random);
+
+            auto const count = list.erase_many(positions.begin(), positions.end());
+            CHECK(count == size - expected.size());
+            CHECK(list.size() == expected.size());
+            CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+            list.push_front("front");
+            list.push_back("back");
+            CHECK(list.front() == "front");
+            CHECK(list.back() == "back");
+        }
+    }
+
+    SUBCASE("emptied blocks are freed")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 36; ++i)
+        {
+            list.push_back(i);
+        }
+        REQUIRE(list.block_count() == 5);
+
+        std::vector<gg::List<int, uint8_t>::const_iterator> positions;
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+        {
+            if (*it < 12 || *it % 2 == 0)
+            {
+                positions.push_back(it);
+            }
+        }
+        list.erase_many(positions.begin(), positions.end());
+        CHECK(list.block_count() == 3);
+        CHECK(list.front() == 13);
+        CHECK(list.back() == 35);
+
+        positions.assign({list.cbegin()});
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+        {
+            positions.push_back(it);
+        }
+        CHECK(list.erase_many(positions.begin(), positions.end()) == 12);
+        CHECK(list.empty());
+        CHECK(list.block_count() == 1);
+        list.push_back(1);
+        CHECK(list.front() == 1);
+    }
+}
@@ -601,4 +601,47 @@ TEST_CASE("testing iterator edge cases")
         CHECK(it2 == list.end());
         CHECK(it1 == it2);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("testing block visitation")
+{
+    gg::List<int, uint8_t> list;
+    for (int i=0; i<30; ++i)
+    {
+        list.push_back(i);
+    }
+    list.erase(list.begin(), std::next(list.begin(), 8));
+
+    std::vector<int> values;
+    std::size_t blocks = 0;
+    list.for_each_block([&](int* places, uint8_t flags){
+        ++blocks;
+        for (int i=0; i<8; ++i)
+        {
+            if ((flags & (1u << i)) != 0)
+            {
+                values.push_back(places[i]);
+                places[i] *= 2;
+            }
+        }
+    });
+    CHECK(blocks == list.block_count());
+
+    std::vector<int> expected;
+    for (int i=8; i<30; ++i)
+    {
+        expected.push_back(i);
+    }
+    CHECK(values == expected);
+
+    int sum = 0;
+    static_cast<gg::List<int, uint8_t> const&>(list).for_each_block([&](int const* places, uint8_t flags){
+        for (int i=0; i<8; ++i)
+        {
+            if ((flags & (1u << i)) != 0)
+            {
+                sum += places[i];
+            }
+        }
+    });
+    CHECK(sum == 2*(8+29)*22/2);
+}
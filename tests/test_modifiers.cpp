@@ -16,6 +16,9 @@
 
 #include "doctest/doctest.h"
 #include "C_list.hpp"
+#include <algorithm>
+#include <limits>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -653,4 +656,197 @@ TEST_CASE("testing large scale operations")
             ++expected;
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("testing assign and resize")
+{
+    SUBCASE("assign a count of values")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_front(i);
+        }
+
+        list.assign(20, 7);
+        CHECK(list.size() == 20);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>(20, 7));
+
+        list.assign(50, 3);
+        CHECK(list.size() == 50);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>(50, 3));
+
+        list.assign(0, 1);
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        list.push_back(1);
+        list.push_front(0);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1});
+    }
+
+    SUBCASE("assign an iterator range")
+    {
+        gg::List<std::string, uint8_t> list;
+        for (int i = 0; i < 30; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+        list.remove_if([](std::string const& value){ return value.size() == 1; });
+
+        std::vector<std::string> values;
+        for (int i = 0; i < 40; ++i)
+        {
+            values.push_back("value " + std::to_string(i));
+        }
+
+        list.assign(values.begin(), values.end());
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+
+        list.assign(values.begin(), values.begin() + 9);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>(values.begin(), values.begin() + 9));
+
+        list.push_front("front");
+        list.push_back("back");
+        CHECK(list.front() == "front");
+        CHECK(list.back() == "back");
+        CHECK(list.size() == 11);
+    }
+
+    SUBCASE("assign keeps the existing blocks")
+    {
+        gg::List<int, uint8_t> list;
+        list.assign(64, 1);
+        int const* first = &list.front();
+
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            list.assign(64, frame);
+            CHECK(&list.front() == first);
+            CHECK(list.size() == 64);
+            CHECK(list.back() == frame);
+        }
+    }
+
+    SUBCASE("resize")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 30; ++i)
+        {
+            list.push_back(i);
+        }
+
+        list.resize(10);
+        CHECK(list.size() == 10);
+        CHECK(list.back() == 9);
+
+        list.resize(16);
+        CHECK(list.size() == 16);
+        CHECK(list.back() == 0);
+
+        list.resize(20, 42);
+        CHECK(list.size() == 20);
+        CHECK(list.back() == 42);
+
+        list.resize(8);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+
+        list.resize(0);
+        CHECK(list.empty());
+        list.push_back(5);
+        CHECK(list.front() == 5);
+    }
+
+    SUBCASE("shrinking keeps the blocks for the next growth")
+    {
+        auto const blockPlaces = [](auto const& list){
+            std::set<void const*> places;
+            list.for_each_block([&](auto const* data, [[maybe_unused]] uint8_t flags){ places.insert(data); });
+            return places;
+        };
+
+        gg::List<std::string, uint8_t> list;
+        list.resize(64, "value");
+        auto const places = blockPlaces(list);
+
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            list.resize(frame, "small");
+            CHECK(list.size() == static_cast<std::size_t>(frame));
+            list.assign(std::size_t{64}, std::string{"frame"});
+            CHECK(list.size() == 64);
+            //No new block was allocated
+            auto const newPlaces = blockPlaces(list);
+            CHECK(std::includes(places.begin(), places.end(), newPlaces.begin(), newPlaces.end()));
+        }
+
+        list.resize(3);
+        list.shrink_to_fit();
+        list.resize(64);
+        CHECK(list.size() == 64);
+        CHECK(list.block_count() == 8);
+
+        list.resize(0);
+        list.clear();
+        list.push_front("front");
+        list.push_back("back");
+        CHECK(list.size() == 2);
+        CHECK(list.front() == "front");
+    }
+
+    SUBCASE("construct from integral count and value")
+    {
+        gg::List<int> list(std::size_t{3}, 5);
+        gg::List<std::size_t> other(4, 2);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{5, 5, 5});
+        CHECK(other.size() == 4);
+    }
+
+    SUBCASE("assign with a fill factor")
+    {
+        std::vector<std::string> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            values.push_back(std::to_string(i));
+        }
+
+        gg::List<std::string, uint8_t> list(values.begin(), values.end(), 0.75f);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+        //6 elements per block of 8
+        CHECK(list.block_count() == 17);
+
+        //Every block keeps free places spread between its elements, inserting there doesn't allocate
+        auto it = list.begin();
+        for (int i = 0; i < 16; ++i)
+        {
+            it = std::next(list.insert(std::next(it, 3), "new"), 4);
+        }
+        CHECK(list.size() == 116);
+        CHECK(list.block_count() == 17);
+
+        list.assign(std::size_t{10}, std::string{"x"}, 0.5f);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>(10, "x"));
+        CHECK(list.block_count() == 3);
+
+        list.assign(values.begin(), values.begin() + 40, 1.0f);
+        CHECK(list.block_count() == 5);
+        list.push_front("front");
+        list.push_back("back");
+        CHECK(list.front() == "front");
+        CHECK(list.back() == "back");
+        CHECK(list.size() == 42);
+
+        //Fill factors out of range fill the blocks completely
+        gg::List<int, uint64_t> other(std::size_t{1000}, 1, 0.0f);
+        CHECK(other.size() == 1000);
+        CHECK(std::count(other.begin(), other.end(), 1) == 1000);
+        CHECK(other.block_count() == 16);
+        for (float const fillFactor : {-1.0f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(), 2.0f})
+        {
+            other.assign(std::size_t{1000}, 2, fillFactor);
+            CHECK(other.size() == 1000);
+            CHECK(other.block_count() == 16);
+        }
+        other.assign(std::size_t{0}, 1, 0.5f);
+        CHECK(other.empty());
+    }
+}
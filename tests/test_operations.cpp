@@ -0,0 +1,823 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "doctest/doctest.h"
+#include "C_list.hpp"
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+
+TEST_CASE("testing remove_if and remove")
+{
+    SUBCASE("remove_if keeping the layout")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+
+        auto const removed = list.remove_if([](int value){ return value % 3 != 0; });
+
+        CHECK(removed == 66);
+        CHECK(list.size() == 34);
+
+        int expected = 0;
+        for (auto const& value : list)
+        {
+            CHECK(value == expected);
+            expected += 3;
+        }
+    }
+
+    SUBCASE("remove_if with compaction")
+    {
+        gg::List<std::string, uint8_t> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+
+        auto const removed = list.remove_if([](std::string const& value){ return value.size() == 2; }, gg::Compactions::PACK);
+
+        CHECK(removed == 90);
+        CHECK(list.size() == 10);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) ==
+              std::vector<std::string>{"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"});
+
+        list.push_back("back");
+        list.push_front("front");
+        CHECK(list.front() == "front");
+        CHECK(list.back() == "back");
+        CHECK(list.size() == 12);
+    }
+
+    SUBCASE("remove every element")
+    {
+        gg::List<int> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(7);
+        }
+
+        SUBCASE("keeping the layout")
+        {
+            CHECK(list.remove(7) == 100);
+        }
+        SUBCASE("with compaction")
+        {
+            CHECK(list.remove(7, gg::Compactions::PACK) == 100);
+        }
+
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        list.push_back(1);
+        CHECK(list.front() == 1);
+    }
+
+    SUBCASE("remove a value that is an element of the list")
+    {
+        for (auto compaction : {gg::Compactions::NONE, gg::Compactions::PACK})
+        {
+            gg::List<std::string, uint8_t> list;
+            for (int i = 0; i < 60; ++i)
+            {
+                list.push_back(std::string(40, static_cast<char>('a' + i % 3)));
+            }
+
+            CHECK(list.remove(list.front(), compaction) == 20);
+            CHECK(list.size() == 40);
+            CHECK(std::count(list.begin(), list.end(), std::string(40, 'a')) == 0);
+
+            CHECK(list.remove(*std::next(list.begin(), 15), compaction) == 20);
+            CHECK(std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>(20, std::string(40, 'b')));
+        }
+    }
+
+    SUBCASE("erase_if free function")
+    {
+        gg::List<int> list;
+        for (int i = 0; i < 10; ++i)
+        {
+            list.push_front(i);
+        }
+
+        auto const removed = gg::erase_if(list, [](int value){ return value >= 5; });
+
+        CHECK(removed == 5);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{4, 3, 2, 1, 0});
+    }
+}
+
+TEST_CASE("testing unique")
+{
+    SUBCASE("unique removes consecutive duplicates")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 50; ++i)
+        {
+            list.push_back(i / 5);
+        }
+
+        SUBCASE("keeping the layout")
+        {
+            CHECK(list.unique() == 40);
+        }
+        SUBCASE("with compaction")
+        {
+            CHECK(list.unique(gg::Compactions::PACK) == 40);
+        }
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SUBCASE("unique with a binary predicate")
+    {
+        gg::List<std::string> list;
+        list.push_back("apple");
+        list.push_back("avocado");
+        list.push_back("banana");
+        list.push_back("blueberry");
+        list.push_back("apricot");
+
+        auto const removed = list.unique([](std::string const& a, std::string const& b){ return a[0] == b[0]; });
+
+        CHECK(removed == 2);
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>{"apple", "banana", "apricot"});
+    }
+}
+
+TEST_CASE("testing sort")
+{
+    SUBCASE("sort integers")
+    {
+        std::mt19937 random{42};
+        std::vector<int> values;
+        gg::List<int> list;
+        for (int i = 0; i < 5000; ++i)
+        {
+            values.push_back(static_cast<int>(random() % 1000) - 500);
+            list.push_back(values.back());
+        }
+
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        CHECK(list.size() == 5000);
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("sort strings with a comparator on a fragmented list")
+    {
+        std::mt19937 random{42};
+        std::vector<std::string> values;
+        gg::List<std::string, uint8_t> list;
+        for (int i = 0; i < 5000; ++i)
+        {
+            values.push_back(std::to_string(random() % 100000));
+            if (i % 2 == 0)
+            {
+                list.push_back(values.back());
+            }
+            else
+            {
+                list.push_front(values.back());
+            }
+        }
+        list.remove_if([](std::string const& value){ return value.back() == '0'; });
+        values.erase(std::remove_if(values.begin(), values.end(), [](std::string const& value){ return value.back() == '0'; }), values.end());
+
+        list.sort(std::greater<>{});
+        std::sort(values.begin(), values.end(), std::greater<>{});
+
+        CHECK(list.size() == values.size());
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+
+        list.push_front("front");
+        list.push_back("back");
+        CHECK(list.front() == "front");
+        CHECK(list.back() == "back");
+    }
+
+    SUBCASE("sort is stable")
+    {
+        gg::List<std::pair<int, std::string>> list;
+        for (int i = 0; i < 3000; ++i)
+        {
+            list.push_back(std::make_pair(i % 7, std::to_string(i)));
+        }
+
+        list.sort([](auto const& a, auto const& b){ return a.first < b.first; });
+
+        auto it = list.begin();
+        for (int key = 0; key < 7; ++key)
+        {
+            for (int i = key; i < 3000; i += 7)
+            {
+                CHECK(it->first == key);
+                CHECK(it->second == std::to_string(i));
+                ++it;
+            }
+        }
+        CHECK(it == list.end());
+    }
+
+    SUBCASE("sort large trivially copyable elements by blocks")
+    {
+        struct Record
+        {
+            int _key;
+            char _payload[60];
+        };
+
+        std::mt19937 random{42};
+        std::vector<int> keys;
+        gg::List<Record, uint8_t> list;
+        for (int i = 0; i < 3000; ++i)
+        {
+            keys.push_back(static_cast<int>(random() % 1000));
+            Record record{keys.back(), {}};
+            record._payload[59] = static_cast<char>(i % 100);
+            list.push_back(record);
+        }
+
+        list.sort([](Record const& a, Record const& b){ return a._key < b._key; });
+        std::sort(keys.begin(), keys.end());
+
+        CHECK(list.size() == keys.size());
+        std::vector<int> sortedKeys;
+        for (auto const& record : list)
+        {
+            sortedKeys.push_back(record._key);
+        }
+        CHECK(sortedKeys == keys);
+    }
+
+    SUBCASE("sort a list with holes in a scratch buffer")
+    {
+        for (bool descending : {false, true})
+        {
+            gg::List<int, uint8_t> list;
+            for (int i = 0; i < 100; ++i)
+            {
+                list.push_back(i);
+            }
+            for (auto it = list.begin(); it != list.end();)
+            {
+                it = std::next(list.erase(it));
+            }
+            REQUIRE(list.size() == 50);
+
+            if (descending)
+            {
+                list.sort(std::greater<>{});
+            }
+            else
+            {
+                list.sort();
+            }
+
+            CHECK(list.size() == 50);
+            CHECK(std::distance(list.begin(), list.end()) == 50);
+            CHECK(std::is_sorted(list.begin(), list.end(), [descending](int a, int b){ return descending ? a > b : a < b; }));
+        }
+    }
+
+    SUBCASE("sort empty and single element lists")
+    {
+        gg::List<int> list;
+        list.sort();
+        CHECK(list.empty());
+
+        list.push_back(1);
+        list.sort();
+        CHECK(list.size() == 1);
+        CHECK(list.front() == 1);
+    }
+}
+
+TEST_CASE("testing radix sort of arithmetic types")
+{
+    std::mt19937_64 random{42};
+
+    SUBCASE("unsigned integers")
+    {
+        std::vector<uint32_t> values;
+        gg::List<uint32_t, uint8_t> list;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(static_cast<uint32_t>(random()));
+            list.push_back(values.back());
+        }
+
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        CHECK(std::vector<uint32_t>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("signed integers")
+    {
+        std::vector<int64_t> values;
+        gg::List<int64_t> list;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(static_cast<int64_t>(random()) >> (i % 50));
+            list.push_front(values.back());
+        }
+
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        CHECK(std::vector<int64_t>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("small keys with a lot of duplicates")
+    {
+        std::vector<int8_t> values;
+        gg::List<int8_t, uint64_t> list;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(static_cast<int8_t>(random()));
+            list.push_back(values.back());
+        }
+
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        CHECK(std::vector<int8_t>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("floating points")
+    {
+        std::vector<float> valuesFloat;
+        std::vector<double> valuesDouble;
+        gg::List<float> listFloat;
+        gg::List<double> listDouble;
+        for (int i = 0; i < 10000; ++i)
+        {
+            double const value = (static_cast<double>(random() % 2000000) - 1000000.0) / 7.0;
+            valuesFloat.push_back(static_cast<float>(value));
+            valuesDouble.push_back(value);
+            listFloat.push_back(static_cast<float>(value));
+            listDouble.push_back(value);
+        }
+
+        listFloat.sort();
+        listDouble.sort();
+        std::sort(valuesFloat.begin(), valuesFloat.end());
+        std::sort(valuesDouble.begin(), valuesDouble.end());
+
+        CHECK(std::vector<float>(listFloat.begin(), listFloat.end()) == valuesFloat);
+        CHECK(std::vector<double>(listDouble.begin(), listDouble.end()) == valuesDouble);
+    }
+
+#ifdef __SIZEOF_INT128__
+    SUBCASE("integers wider than 64 bits are comparison sorted")
+    {
+        __extension__ using Int128 = __int128;
+
+        std::vector<Int128> values;
+        gg::List<Int128> list;
+        for (int i = 0; i < 2000; ++i)
+        {
+            values.push_back((static_cast<Int128>(random()) << 64) | static_cast<Int128>(random()));
+            list.push_back(values.back());
+        }
+
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        CHECK(std::equal(list.begin(), list.end(), values.begin(), values.end()));
+    }
+#endif
+
+    SUBCASE("the sorted list is packed and still usable")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 4000; ++i)
+        {
+            list.push_back(4000 - i);
+        }
+        list.remove_if([](int value){ return value % 2 == 0; });
+
+        list.sort();
+
+        CHECK(list.size() == 2000);
+        CHECK(list.front() == 1);
+        CHECK(list.back() == 3999);
+
+        list.push_front(0);
+        list.push_back(4001);
+        CHECK(list.front() == 0);
+        CHECK(list.back() == 4001);
+        CHECK(std::is_sorted(list.begin(), list.end()));
+    }
+}
+
+TEST_CASE("testing merge")
+{
+    SUBCASE("merge two sorted lists")
+    {
+        gg::List<std::string> list;
+        gg::List<std::string> other;
+        for (int i = 0; i < 1000; i += 2)
+        {
+            list.push_back(std::to_string(10000 + i));
+            other.push_back(std::to_string(10001 + i));
+        }
+
+        list.merge(other);
+
+        CHECK(list.size() == 1000);
+        CHECK(other.empty());
+
+        int expected = 10000;
+        for (auto const& value : list)
+        {
+            CHECK(value == std::to_string(expected));
+            ++expected;
+        }
+    }
+
+    SUBCASE("merge keeps equal elements of this list first")
+    {
+        gg::List<std::pair<int, int>> list;
+        gg::List<std::pair<int, int>> other;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(std::make_pair(i / 10, 0));
+            other.push_back(std::make_pair(i / 10, 1));
+        }
+
+        list.merge(std::move(other), [](auto const& a, auto const& b){ return a.first < b.first; });
+
+        CHECK(list.size() == 200);
+        auto it = list.begin();
+        for (int key = 0; key < 10; ++key)
+        {
+            for (int i = 0; i < 20; ++i)
+            {
+                CHECK(it->first == key);
+                CHECK(it->second == (i < 10 ? 0 : 1));
+                ++it;
+            }
+        }
+    }
+
+    SUBCASE("merge into an empty list")
+    {
+        gg::List<int> list;
+        gg::List<int> other;
+        other.push_back(1);
+        other.push_back(2);
+
+        list.merge(other);
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2});
+        CHECK(other.empty());
+    }
+}
+
+TEST_CASE("testing reverse")
+{
+    SUBCASE("reverse a fragmented list of trivial elements")
+    {
+        gg::List<int, uint8_t> list;
+        std::vector<int> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+            list.push_front(-i);
+        }
+        list.remove_if([](int value){ return value % 3 == 0; });
+        values.assign(list.begin(), list.end());
+
+        list.reverse();
+        std::reverse(values.begin(), values.end());
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+        CHECK(list.front() == values.front());
+        CHECK(list.back() == values.back());
+
+        list.push_front(1000);
+        list.push_back(2000);
+        CHECK(list.front() == 1000);
+        CHECK(list.back() == 2000);
+        CHECK(list.size() == values.size() + 2);
+    }
+
+    SUBCASE("reverse non trivial elements")
+    {
+        gg::List<std::string, uint16_t> list;
+        std::vector<std::string> values;
+        for (int i = 0; i < 50; ++i)
+        {
+            list.push_back("a long string to avoid small string optimization " + std::to_string(i));
+        }
+        list.remove_if([](std::string const& value){ return value.back() == '7'; });
+        values.assign(list.begin(), list.end());
+
+        list.reverse();
+        std::reverse(values.begin(), values.end());
+
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("reverse elements that can't be assigned")
+    {
+        struct Unassignable
+        {
+            explicit Unassignable(std::string value) : _value(std::move(value)) {}
+            Unassignable(Unassignable&& r) = default;
+            Unassignable& operator=(Unassignable&& r) = delete;
+
+            std::string _value;
+        };
+
+        gg::List<Unassignable, uint8_t> list;
+        std::vector<std::string> values;
+        for (int i = 0; i < 30; ++i)
+        {
+            values.push_back("a long string to avoid small string optimization " + std::to_string(i));
+            list.emplace_back(values.back());
+        }
+
+        list.reverse();
+        std::reverse(values.begin(), values.end());
+
+        std::vector<std::string> result;
+        for (auto const& element : list)
+        {
+            result.push_back(element._value);
+        }
+        CHECK(result == values);
+    }
+
+    SUBCASE("reverse empty and single element lists")
+    {
+        gg::List<int> list;
+        list.reverse();
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        list.push_back(1);
+        list.reverse();
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1});
+        list.push_back(2);
+        list.push_front(0);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2});
+    }
+}
+
+TEST_CASE("testing compact")
+{
+    SUBCASE("compact trivially copyable elements")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+        list.remove_if([](int value){ return value % 5 != 0 && value % 7 != 0; });
+        std::vector<int> const values(list.begin(), list.end());
+
+        list.compact();
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+        CHECK(list.size() == values.size());
+
+        //Packed elements are contiguous in their blocks
+        std::size_t contiguous = 0;
+        for (auto it = list.begin(); std::next(it) != list.end(); ++it)
+        {
+            contiguous += &*std::next(it) == &*it + 1 ? 1 : 0;
+        }
+        CHECK(contiguous >= values.size() - (values.size() + 7) / 8);
+
+        list.push_front(-1);
+        list.push_back(-2);
+        CHECK(list.front() == -1);
+        CHECK(list.back() == -2);
+    }
+
+    SUBCASE("compact non trivial elements")
+    {
+        gg::List<std::string, uint16_t> list;
+        for (int i = 0; i < 500; ++i)
+        {
+            list.push_front("a long string to avoid small string optimization " + std::to_string(i));
+        }
+        list.remove_if([](std::string const& value){ return value.back() != '3'; });
+        std::vector<std::string> const values(list.begin(), list.end());
+
+        list.shrink_to_fit();
+
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+        list.emplace_back("back");
+        CHECK(list.back() == "back");
+    }
+
+    SUBCASE("compact full and empty lists")
+    {
+        gg::List<uint64_t, uint64_t> list;
+        list.compact();
+        CHECK(list.empty());
+
+        for (uint64_t i = 0; i < 200; ++i)
+        {
+            list.push_back(i);
+        }
+        list.compact();
+        CHECK(list.size() == 200);
+        CHECK(list.front() == 0);
+        CHECK(list.back() == 199);
+    }
+}
+
+TEST_CASE("testing incremental compaction")
+{
+    auto countBlocks = [](auto const& list){
+        //Every element that isn't right after the previous one starts a new run, a block holds at least one run
+        std::size_t blocks = list.empty() ? 0 : 1;
+        for (auto it = list.begin(); std::next(it) != list.end(); ++it)
+        {
+            auto const distance = &*std::next(it) - &*it;
+            blocks += distance < 0 || distance >= 8 ? 1 : 0;
+        }
+        return blocks;
+    };
+
+    SUBCASE("compact_step merges sparse blocks within the budget")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 800; ++i)
+        {
+            list.push_back(i);
+        }
+        list.remove_if([](int value){ return value % 4 != 0; });
+        std::vector<int> const values(list.begin(), list.end());
+        std::size_t const blocksBefore = countBlocks(list);
+
+        std::size_t const moves = list.compact_step(10);
+        CHECK(moves <= 10);
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(list.compact_step(16) <= 16);
+        }
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+        CHECK(countBlocks(list) < blocksBefore);
+        CHECK(countBlocks(list) <= values.size() / 4 + 1);
+
+        list.push_front(-1);
+        list.push_back(-2);
+        CHECK(list.front() == -1);
+        CHECK(list.back() == -2);
+    }
+
+    SUBCASE("a budget too small for any merge only walks the chain")
+    {
+        gg::List<std::string, uint8_t> list;
+        for (int i = 0; i < 64; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+        list.remove_if([](std::string const& value){ return std::stoi(value) % 2 == 0; });
+        std::vector<std::string> const values(list.begin(), list.end());
+
+        for (int i = 0; i < 20; ++i)
+        {
+            CHECK(list.compact_step(1) <= 1);
+        }
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+    }
+
+    SUBCASE("erase runs a compaction step and keeps the returned iterator valid")
+    {
+        gg::List<int, uint8_t> list;
+        list.set_erase_compaction(8);
+        CHECK(list.get_erase_compaction() == 8);
+
+        std::vector<int> values;
+        for (int i = 0; i < 400; ++i)
+        {
+            list.push_back(i);
+            values.push_back(i);
+        }
+
+        auto it = list.begin();
+        auto valueIt = values.begin();
+        while (it != list.end())
+        {
+            if (*it % 3 != 0)
+            {
+                it = list.erase(it);
+                valueIt = values.erase(valueIt);
+            }
+            else
+            {
+                ++it;
+                ++valueIt;
+            }
+            CHECK(valueIt == values.end() ? it == list.end() : *it == *valueIt);
+        }
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+        CHECK(countBlocks(list) <= values.size() / 4 + 2);
+    }
+}
+
+TEST_CASE("testing density floor")
+{
+    SUBCASE("erasing keeps blocks above the floor when neighbours can absorb them")
+    {
+        gg::List<int, uint8_t> list;
+        list.set_density_floor(0.5f);
+        CHECK(list.get_density_floor() == doctest::Approx(0.5f));
+
+        std::vector<int> values;
+        for (int i = 0; i < 800; ++i)
+        {
+            list.push_back(i);
+            values.push_back(i);
+        }
+
+        std::mt19937 random{7};
+        auto it = list.begin();
+        auto valueIt = values.begin();
+        while (it != list.end())
+        {
+            if (random() % 4 != 0)
+            {
+                it = list.erase(it);
+                valueIt = values.erase(valueIt);
+            }
+            else
+            {
+                ++it;
+                ++valueIt;
+            }
+            CHECK(valueIt == values.end() ? it == list.end() : *it == *valueIt);
+        }
+
+        CHECK(std::vector<int>(list.begin(), list.end()) == values);
+        //Two neighbours under the floor can always be merged, so at most every other block is sparse
+        CHECK(list.block_count() <= values.size() / 2 + 1);
+
+        list.push_front(-1);
+        list.push_back(-2);
+        CHECK(list.front() == -1);
+        CHECK(list.back() == -2);
+    }
+
+    SUBCASE("range erase merges the partial blocks")
+    {
+        gg::List<std::string, uint8_t> list;
+        gg::List<std::string, uint8_t> listWithoutFloor;
+        list.set_density_floor(0.5f);
+        std::vector<std::string> values;
+        for (int i = 0; i < 64; ++i)
+        {
+            list.push_back(std::to_string(i));
+            listWithoutFloor.push_back(std::to_string(i));
+            values.push_back(std::to_string(i));
+        }
+
+        auto const it = list.erase(std::next(list.begin(), 5), std::next(list.begin(), 58));
+        listWithoutFloor.erase(std::next(listWithoutFloor.begin(), 5), std::next(listWithoutFloor.begin(), 58));
+        values.erase(values.begin() + 5, values.begin() + 58);
+
+        CHECK(*it == "58");
+        CHECK(std::vector<std::string>(list.begin(), list.end()) == values);
+        CHECK(list.block_count() < listWithoutFloor.block_count());
+        CHECK(list.block_count() == 2);
+    }
+
+    SUBCASE("without a floor sparse blocks are kept")
+    {
+        gg::List<int, uint8_t> list;
+        for (int i = 0; i < 64; ++i)
+        {
+            list.push_back(i);
+        }
+        list.remove_if([](int value){ return value % 8 != 0; });
+        CHECK(list.block_count() == 8);
+    }
+}
@@ -0,0 +1,313 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "C_parallel.hpp"
+#include <string>
+#include <numeric>
+#include <stdexcept>
+
+TEST_CASE("testing thread pool")
+{
+    SUBCASE("every task is run once")
+    {
+        for (std::size_t threads : {1, 2, 4})
+        {
+            gg::par::ThreadPool pool{threads};
+            CHECK(pool.thread_count() == threads);
+
+            for (std::size_t count : {0, 1, 7, 1000})
+            {
+                std::vector<std::atomic<int>> runs(count);
+                pool.run(count, [&](std::size_t task){
+                    ++runs[task];
+                });
+
+                bool once = true;
+                for (auto const& run : runs)
+                {
+                    once = once && run.load() == 1;
+                }
+                CHECK(once);
+            }
+        }
+    }
+
+    SUBCASE("exceptions are rethrown")
+    {
+        gg::par::ThreadPool pool{3};
+        CHECK_THROWS_AS(pool.run(100, [](std::size_t task){
+            if (task == 42)
+            {
+                throw std::runtime_error("task");
+            }
+        }), std::runtime_error);
+
+        //The pool is still usable
+        std::atomic<std::size_t> count{0};
+        pool.run(100, [&](std::size_t){++count;});
+        CHECK(count.load() == 100);
+    }
+}
+
+TEST_CASE("testing parallel algorithms")
+{
+    gg::par::ThreadPool pool{4};
+
+    gg::List<int, uint8_t> list;
+    for (int i=0; i<10000; ++i)
+    {
+        list.push_back(i);
+    }
+    //Leave sparse and empty blocks around
+    int index = 0;
+    list.remove_if([&](int){return (index++ % 40) < 13;});
+    std::vector<int> values(list.begin(), list.end());
+
+    SUBCASE("for_each and transform")
+    {
+        std::atomic<long long> sum{0};
+        gg::par::for_each(pool, list, [&](int value){sum += value;});
+        CHECK(sum.load() == std::accumulate(values.begin(), values.end(), 0LL));
+
+        gg::par::transform(pool, list, [](int value){return value*2;});
+        gg::par::for_each(pool, list, [](int& value){++value;});
+
+        bool transformed = true;
+        auto it = values.begin();
+        for (auto const value : list)
+        {
+            transformed = transformed && value == *it++ * 2 + 1;
+        }
+        CHECK(transformed);
+    }
+
+    SUBCASE("reduce and count_if")
+    {
+        CHECK(gg::par::reduce(pool, list, 0LL) == std::accumulate(values.begin(), values.end(), 0LL));
+        CHECK(gg::par::reduce(pool, list, 1, [](int a, int b){return std::max(a, b);}) == values.back());
+        CHECK(gg::par::reduce(pool, gg::List<int>{}, 5) == 5);
+
+        CHECK(gg::par::count_if(pool, list, [](int value){return value%3 == 0;}) ==
+              static_cast<std::size_t>(std::count_if(values.begin(), values.end(), [](int value){return value%3 == 0;})));
+
+        gg::List<std::string> strings;
+        for (int i=0; i<500; ++i)
+        {
+            strings.push_back(std::to_string(i%10));
+        }
+        CHECK(gg::par::reduce(pool, strings, std::string{}, [](std::string const& a, std::string const& b){return a.size() > b.size() ? a : b;}).size() == 1);
+    }
+
+    SUBCASE("find_if")
+    {
+        auto it = gg::par::find_if(pool, list, [](int value){return value > 5000;});
+        CHECK(it != list.end());
+        CHECK(*it == *std::find_if(values.begin(), values.end(), [](int value){return value > 5000;}));
+
+        //The returned iterator is a valid list iterator
+        list.erase(it);
+        CHECK(list.size() == values.size()-1);
+
+        gg::List<int, uint8_t> const& constList = list;
+        auto constIt = gg::par::find_if(pool, constList, [](int value){return value == 13;});
+        CHECK(*constIt == 13);
+        CHECK(gg::par::find_if(pool, constList, [](int value){return value < 0;}) == constList.end());
+
+        //Smallest match in list order even when later ranges also match
+        CHECK(*gg::par::find_if(pool, list, [](int value){return value%2 == 0;}) == 14);
+    }
+
+    SUBCASE("default pool")
+    {
+        CHECK(gg::par::count_if(list, [](int){return true;}) == values.size());
+        CHECK(gg::par::reduce(list, 0LL) == std::accumulate(values.begin(), values.end(), 0LL));
+    }
+}
+
+namespace
+{
+
+struct LiveCounter
+{
+    LiveCounter() : _value(-1) {++gLiveCount;}
+    LiveCounter(int value) : _value(value) {++gLiveCount;}
+    LiveCounter(LiveCounter const& r) : _value(r._value)
+    {
+        if (r._value == gThrowValue && ++gCopies == 100)
+        {
+            throw std::runtime_error("copy");
+        }
+        ++gLiveCount;
+    }
+    ~LiveCounter() {--gLiveCount;}
+
+    int _value;
+    inline static std::atomic<int> gLiveCount{0};
+    inline static int gThrowValue = -2;
+    inline static std::atomic<int> gCopies{0};
+};
+
+}//end
+
+TEST_CASE("testing parallel construction and clear")
+{
+    gg::par::ThreadPool pool{4};
+
+    SUBCASE("make_list")
+    {
+        for (std::size_t size : {0, 1, 8, 9, 1000, 1001})
+        {
+            auto list = gg::par::make_list<gg::List<int, uint8_t>>(pool, size, 7);
+            CHECK(list.size() == size);
+            CHECK(static_cast<std::size_t>(std::count(list.begin(), list.end(), 7)) == size);
+            CHECK(list.block_count() == std::max<std::size_t>(1, (size+7)/8));
+
+            //The list is usable as any other one
+            list.push_front(1);
+            list.push_back(2);
+            list.insert(std::next(list.begin()), 3);
+            CHECK(list.size() == size+3);
+            CHECK(list.front() == 1);
+            CHECK(list.back() == 2);
+        }
+
+        auto list = gg::par::make_list<gg::List<std::string>>(pool, 100);
+        CHECK(list.size() == 100);
+        CHECK(list.front().empty());
+    }
+
+    SUBCASE("clear")
+    {
+        {
+            auto list = gg::par::make_list<gg::List<LiveCounter, uint8_t>>(pool, 1000, LiveCounter{3});
+            CHECK(LiveCounter::gLiveCount == 1000);
+
+            gg::par::clear(pool, list);
+            CHECK(LiveCounter::gLiveCount == 0);
+            CHECK(list.empty());
+            CHECK(list.block_count() == 1);
+
+            list.emplace_back(1);
+            list.emplace_front(0);
+            CHECK(list.size() == 2);
+            CHECK(list.front()._value == 0);
+
+            gg::par::clear(pool, list);
+            CHECK(list.empty());
+
+            gg::List<LiveCounter, uint8_t> moved{std::move(list)};
+            gg::par::clear(pool, list);
+            CHECK(list.empty());
+        }
+        CHECK(LiveCounter::gLiveCount == 0);
+    }
+
+    SUBCASE("exception while constructing")
+    {
+        LiveCounter::gThrowValue = 5;
+        LiveCounter::gCopies = 0;
+        CHECK_THROWS_AS(static_cast<void>(gg::par::make_list<gg::List<LiveCounter, uint8_t>>(pool, 1000, LiveCounter{5})), std::runtime_error);
+        CHECK(LiveCounter::gLiveCount == 0);
+        LiveCounter::gThrowValue = -2;
+    }
+}
+
+TEST_CASE("testing asynchronous release")
+{
+    gg::par::Reclaimer reclaimer;
+
+    SUBCASE("release")
+    {
+        auto list = gg::par::make_list<gg::List<LiveCounter, uint8_t>>(gg::par::default_pool(), 1000, LiveCounter{3});
+        CHECK(LiveCounter::gLiveCount == 1000);
+
+        gg::par::release_async(reclaimer, list);
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+        CHECK(list.block_count() == 1);
+        CHECK(list.begin() == list.end());
+
+        //The list is usable while the old chain is reclaimed
+        list.emplace_back(1);
+        list.emplace_front(0);
+        list.emplace_back(2);
+        CHECK(list.size() == 3);
+        CHECK(list.front()._value == 0);
+        CHECK(list.back()._value == 2);
+
+        reclaimer.wait();
+        CHECK(reclaimer.pending() == 0);
+        CHECK(LiveCounter::gLiveCount == 3);
+
+        gg::par::release_async(reclaimer, list);
+        reclaimer.wait();
+        CHECK(LiveCounter::gLiveCount == 0);
+        CHECK(list.empty());
+    }
+
+    SUBCASE("many lists and moved from list")
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            gg::List<LiveCounter, uint8_t> list;
+            for (int j = 0; j < i*10; ++j)
+            {
+                list.emplace_back(j);
+            }
+            gg::par::release_async(reclaimer, list);
+        }
+
+        gg::List<LiveCounter, uint8_t> list;
+        list.emplace_back(1);
+        gg::List<LiveCounter, uint8_t> moved{std::move(list)};
+        gg::par::release_async(reclaimer, list);
+        CHECK(list.empty());
+        list.emplace_back(2);
+        CHECK(list.size() == 1);
+        gg::par::release_async(reclaimer, moved);
+
+        reclaimer.wait();
+        CHECK(LiveCounter::gLiveCount == 1);
+    }
+
+    SUBCASE("spare blocks kept by a shrink are given too")
+    {
+        gg::List<LiveCounter, uint8_t> list;
+        list.resize(100);
+        list.resize(2);
+        gg::par::release_async(reclaimer, list);
+        list.resize(50);
+        list.resize(1);
+        gg::par::clear(gg::par::default_pool(), list);
+        list.resize(20);
+        CHECK(list.size() == 20);
+        gg::par::release_async(reclaimer, list);
+        reclaimer.wait();
+        CHECK(LiveCounter::gLiveCount == 0);
+    }
+
+    SUBCASE("default reclaimer")
+    {
+        gg::List<std::string> list(1000, std::string(40, 'x'));
+        gg::par::release_async(list);
+        CHECK(list.empty());
+        list.push_back("after");
+        CHECK(list.front() == "after");
+        gg::par::default_reclaimer().wait();
+    }
+}
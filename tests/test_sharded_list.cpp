@@ -0,0 +1,141 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "C_shardedList.hpp"
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+TEST_CASE("testing sharded list")
+{
+    SUBCASE("single thread")
+    {
+        gg::ShardedList<int, uint8_t> list;
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+        CHECK(list.shard_count() == 0);
+        CHECK(list.begin() == list.end());
+
+        for (int i=0; i<20; ++i)
+        {
+            list.push_back(i);
+        }
+        CHECK(list.shard_count() == 1);
+        CHECK(list.size() == 20);
+        CHECK(&list.local() == &list.local());
+        CHECK(list.local().size() == 20);
+
+        int expected = 0;
+        for (auto const value : list)
+        {
+            CHECK(value == expected++);
+        }
+        CHECK(expected == 20);
+
+        list.clear();
+        CHECK(list.empty());
+        CHECK(list.shard_count() == 1);
+    }
+
+    SUBCASE("many lists on one thread")
+    {
+        //More lists than thread cache entries, each one keeps its own shard
+        std::vector<std::unique_ptr<gg::ShardedList<std::string>>> lists;
+        for (int i=0; i<20; ++i)
+        {
+            lists.emplace_back(new gg::ShardedList<std::string>{});
+        }
+        for (int round=0; round<3; ++round)
+        {
+            for (std::size_t i=0; i<lists.size(); ++i)
+            {
+                lists[i]->emplace_back(std::to_string(i));
+            }
+        }
+
+        bool valid = true;
+        for (std::size_t i=0; i<lists.size(); ++i)
+        {
+            valid = valid && lists[i]->shard_count() == 1 && lists[i]->size() == 3;
+            for (auto const& value : *lists[i])
+            {
+                valid = valid && value == std::to_string(i);
+            }
+        }
+        CHECK(valid);
+    }
+
+    SUBCASE("multiple threads and consolidate")
+    {
+        constexpr int threadCount = 4;
+        constexpr int perThread = 5000;
+
+        gg::ShardedList<int, uint16_t> list;
+        list.push_back(-1);
+
+        std::vector<std::thread> threads;
+        for (int t=0; t<threadCount; ++t)
+        {
+            threads.emplace_back([&list, t](){
+                for (int i=0; i<perThread; ++i)
+                {
+                    list.push_back(t*perThread + i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(list.size() == threadCount*perThread + 1);
+        CHECK(list.shard_count() >= 2);
+
+        std::size_t blockElements = 0;
+        list.for_each_block([&](int const*, uint16_t flags){
+            for (; flags != 0; flags &= static_cast<uint16_t>(flags-1))
+            {
+                ++blockElements;
+            }
+        });
+        CHECK(blockElements == list.size());
+
+        auto const blocks = list.block_count();
+        auto consolidated = list.consolidate();
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+        CHECK(consolidated.size() == threadCount*perThread + 1);
+        CHECK(consolidated.front() == -1);
+        CHECK(consolidated.block_count() <= blocks);
+
+        std::vector<int> values(consolidated.begin(), consolidated.end());
+        std::sort(values.begin(), values.end());
+        bool unique = true;
+        for (int i=0; i<threadCount*perThread; ++i)
+        {
+            unique = unique && values[i+1] == i;
+        }
+        CHECK(unique);
+
+        //The shards are still registered and reusable
+        list.push_back(7);
+        CHECK(list.size() == 1);
+        CHECK(*list.begin() == 7);
+    }
+}
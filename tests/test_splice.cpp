@@ -744,4 +744,126 @@ TEST_CASE("testing splice edge cases")
             ++expectedIt;
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("testing splice range")
+{
+    SUBCASE("splice range from the middle of another list")
+    {
+        gg::List<int> dest;
+        gg::List<int> source;
+
+        dest.push_back(-1);
+        dest.push_back(-2);
+        for (int i = 0; i < 100; ++i)
+        {
+            source.push_back(i);
+        }
+
+        auto first = source.begin();
+        for (int i = 0; i < 10; ++i) { ++first; }
+        auto last = first;
+        for (int i = 0; i < 50; ++i) { ++last; }
+
+        dest.splice(++dest.begin(), source, first, last);
+
+        CHECK(dest.size() == 52);
+        CHECK(source.size() == 50);
+
+        std::vector<int> expected = {-1};
+        for (int i = 10; i < 60; ++i) { expected.push_back(i); }
+        expected.push_back(-2);
+        CHECK(std::vector<int>(dest.begin(), dest.end()) == expected);
+
+        expected.clear();
+        for (int i = 0; i < 10; ++i) { expected.push_back(i); }
+        for (int i = 60; i < 100; ++i) { expected.push_back(i); }
+        CHECK(std::vector<int>(source.begin(), source.end()) == expected);
+    }
+
+    SUBCASE("splice range up to the end")
+    {
+        gg::List<std::string> dest;
+        gg::List<std::string> source;
+
+        dest.push_back("a");
+        source.push_back("b");
+        source.push_back("c");
+        source.push_back("d");
+
+        dest.splice(dest.end(), source, ++source.begin(), source.end());
+
+        CHECK(dest.size() == 3);
+        CHECK(source.size() == 1);
+        CHECK(std::vector<std::string>(dest.begin(), dest.end()) == std::vector<std::string>{"a", "c", "d"});
+        CHECK(source.front() == "b");
+
+        source.push_back("e");
+        CHECK(source.back() == "e");
+    }
+
+    SUBCASE("splice empty range")
+    {
+        gg::List<int> dest;
+        gg::List<int> source;
+
+        dest.push_back(1);
+        source.push_back(2);
+
+        dest.splice(dest.begin(), source, source.begin(), source.begin());
+
+        CHECK(dest.size() == 1);
+        CHECK(source.size() == 1);
+    }
+
+    SUBCASE("splice range inside the same list")
+    {
+        gg::List<int> list;
+        for (int i = 0; i < 40; ++i)
+        {
+            list.push_back(i);
+        }
+
+        auto first = list.begin();
+        for (int i = 0; i < 20; ++i) { ++first; }
+        auto last = first;
+        for (int i = 0; i < 10; ++i) { ++last; }
+
+        list.splice(list.begin(), list, first, last);
+
+        CHECK(list.size() == 40);
+
+        std::vector<int> expected;
+        for (int i = 20; i < 30; ++i) { expected.push_back(i); }
+        for (int i = 0; i < 20; ++i) { expected.push_back(i); }
+        for (int i = 30; i < 40; ++i) { expected.push_back(i); }
+        CHECK(std::vector<int>(list.begin(), list.end()) == expected);
+    }
+
+    SUBCASE("whole blocks are relinked without moving elements")
+    {
+        gg::List<int, uint8_t> dest;
+        gg::List<int, uint8_t> source;
+
+        dest.push_back(-1);
+        for (int i = 0; i < 64; ++i)
+        {
+            source.push_back(i);
+        }
+
+        std::vector<int const*> addresses;
+        for (auto const& value : source)
+        {
+            addresses.push_back(&value);
+        }
+
+        dest.splice(dest.end(), source);
+
+        CHECK(source.empty());
+        auto address = addresses.begin();
+        for (auto it = ++dest.cbegin(); it != dest.cend(); ++it)
+        {
+            CHECK(&*it == *address);
+            ++address;
+        }
+    }
+}
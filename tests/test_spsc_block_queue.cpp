@@ -0,0 +1,153 @@
+/*
+ * Copyright 2025 Guillaume Guillet
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "doctest/doctest.h"
+#include "C_spscBlockQueue.hpp"
+#include <thread>
+#include <string>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+
+struct ThrowingAssignment
+{
+    ThrowingAssignment() = default;
+    explicit ThrowingAssignment(std::string value) : _value(std::move(value)) {}
+    ThrowingAssignment& operator=(ThrowingAssignment&& r)
+    {
+        if (gThrow)
+        {
+            throw std::runtime_error("assignment");
+        }
+        this->_value = std::move(r._value);
+        return *this;
+    }
+
+    std::string _value;
+    inline static bool gThrow = false;
+};
+
+}//end
+
+TEST_CASE("testing spsc block queue")
+{
+    SUBCASE("single thread")
+    {
+        gg::SpscBlockQueue<int, uint8_t> queue;
+        int value = -1;
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.try_pop(value));
+
+        for (int i=0; i<20; ++i)
+        {
+            queue.push(i);
+        }
+        CHECK_FALSE(queue.empty());
+        CHECK(queue.allocated_block_count() == 3);
+
+        bool ordered = true;
+        for (int i=0; i<20; ++i)
+        {
+            ordered = ordered && queue.try_pop(value) && value == i;
+        }
+        CHECK(ordered);
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.try_pop(value));
+    }
+
+    SUBCASE("drained blocks are reused")
+    {
+        gg::SpscBlockQueue<std::string, uint8_t> queue;
+        std::string value;
+        for (int round=0; round<100; ++round)
+        {
+            for (int i=0; i<30; ++i)
+            {
+                queue.emplace(20, static_cast<char>('a'+i));
+            }
+            for (int i=0; i<30; ++i)
+            {
+                CHECK(queue.try_pop(value));
+            }
+            CHECK(value == std::string(20, 'a'+29));
+        }
+        CHECK(queue.allocated_block_count() <= 6);
+
+        //Elements left in the queue are destroyed with it
+        for (int i=0; i<30; ++i)
+        {
+            queue.emplace(20, 'z');
+        }
+    }
+
+    SUBCASE("move only type")
+    {
+        gg::SpscBlockQueue<std::unique_ptr<int>, uint8_t> queue;
+        queue.push(std::make_unique<int>(5));
+        std::unique_ptr<int> value;
+        CHECK(queue.try_pop(value));
+        CHECK(*value == 5);
+    }
+
+    SUBCASE("a throwing assignment leaves the element in the queue")
+    {
+        gg::SpscBlockQueue<ThrowingAssignment, uint8_t> queue;
+        queue.emplace(std::string(20, 'a'));
+        queue.emplace(std::string(20, 'b'));
+
+        ThrowingAssignment value;
+        ThrowingAssignment::gThrow = true;
+        CHECK_THROWS_AS(static_cast<void>(queue.try_pop(value)), std::runtime_error);
+        ThrowingAssignment::gThrow = false;
+
+        CHECK(queue.try_pop(value));
+        CHECK(value._value == std::string(20, 'a'));
+        CHECK(queue.try_pop(value));
+        CHECK(value._value == std::string(20, 'b'));
+        CHECK(queue.empty());
+    }
+
+    SUBCASE("producer and consumer threads")
+    {
+        constexpr int count = 200000;
+
+        gg::SpscBlockQueue<int, uint16_t> queue;
+        std::thread producer([&queue](){
+            for (int i=0; i<count; ++i)
+            {
+                queue.push(i);
+            }
+        });
+
+        bool ordered = true;
+        int value = 0;
+        for (int i=0; i<count; ++i)
+        {
+            while (!queue.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+            ordered = ordered && value == i;
+        }
+        producer.join();
+
+        CHECK(ordered);
+        CHECK(queue.empty());
+    }
+}